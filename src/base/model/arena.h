@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace eda::base::model {
+
+/**
+ * \brief Implements a chunked bump allocator.
+ *
+ * Objects are placed one after another in large chunks, so that the
+ * objects allocated in a row are adjacent in memory. The addresses are
+ * stable (chunks are never moved); the memory is released all at once
+ * when the arena is destroyed.
+ */
+class Arena final {
+public:
+  /// Default chunk size (in bytes).
+  static constexpr std::size_t CHUNK_SIZE = 1024 * 1024;
+
+  explicit Arena(std::size_t chunkSize = CHUNK_SIZE):
+    _chunkSize(chunkSize), _offset(chunkSize) {}
+
+  Arena(const Arena &) = delete;
+  Arena &operator =(const Arena &) = delete;
+
+  /// Allocates a memory block of the given size.
+  void *allocate(std::size_t size) {
+    constexpr std::size_t align = alignof(std::max_align_t);
+    size = (size + align - 1) & ~(align - 1);
+    assert(size <= _chunkSize);
+
+    if (_offset + size > _chunkSize) {
+      _chunks.emplace_back(new std::byte[_chunkSize]);
+      _offset = 0;
+    }
+
+    void *ptr = _chunks.back().get() + _offset;
+    _offset += size;
+    _allocated += size;
+
+    return ptr;
+  }
+
+  /// Returns the number of allocated bytes.
+  std::size_t allocated() const { return _allocated; }
+  /// Returns the number of reserved bytes.
+  std::size_t reserved() const { return _chunks.size() * _chunkSize; }
+
+private:
+  const std::size_t _chunkSize;
+
+  std::vector<std::unique_ptr<std::byte[]>> _chunks;
+  std::size_t _offset;
+  std::size_t _allocated = 0;
+};
+
+} // namespace eda::base::model
@@ -2,7 +2,7 @@
 //
 // Part of the Utopia EDA Project, under the Apache License v2.0
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2021 ISP RAS (http://www.ispras.ru)
+// Copyright 2021-2026 ISP RAS (http://www.ispras.ru)
 //
 //===----------------------------------------------------------------------===//
 
@@ -12,87 +12,208 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <vector>
 
 namespace eda::base::model {
 
 /**
- * \brief Represents an inexact (loosy) key for hashing net nodes.
- * \author <a href="mailto:kamkin@ispras.ru">Alexander Kamkin</a>
+ * \brief Open-addressing hash table for structural hashing of net nodes.
+ *
+ * The table stores (hash, net, node) entries. The node signatures are not
+ * duplicated in the table: a candidate is checked by the caller-provided
+ * predicate, which makes the lookup exact. The lookups do not allocate.
+ * The entries are removed by backward-shift deletion (no tombstones are
+ * left, so the probe sequences do not degrade as the nets are modified).
  */
 template <typename F, typename N>
-struct NodeHashKey final {
+class StructHashTable final {
+public:
   using Signal = eda::base::model::Signal<N>;
   using SignalList = typename Signal::List;
 
-  /// Constructs a key from the given node signature.
-  NodeHashKey(uint32_t netId, F func, const SignalList &inputs):
-      netId(netId),
-      func(static_cast<uint16_t>(func)),
-      arity(static_cast<uint16_t>(inputs.size())) {
+  /// Empty entry marker.
+  static constexpr N EMPTY = static_cast<N>(-1);
 
-    std::vector<size_t> hashes(inputs.size());
-    for (size_t i = 0; i < inputs.size(); i++) {
-      hashes[i] = std::hash<N>()(inputs[i].node());
+  /// Lookup statistics.
+  struct Stats final {
+    /// Returns the ratio of successful lookups.
+    double hitRate() const {
+      return lookups ? static_cast<double>(hits) / lookups : 0.0;
     }
 
+    /// Returns the average number of probes per lookup.
+    double avgProbes() const {
+      return lookups ? static_cast<double>(probes) / lookups : 0.0;
+    }
+
+    /// Number of lookups.
+    uint64_t lookups = 0;
+    /// Number of successful lookups.
+    uint64_t hits = 0;
+    /// Total number of probed entries.
+    uint64_t probes = 0;
+    /// Maximum number of probed entries per lookup.
+    uint64_t maxProbes = 0;
+  };
+
+  explicit StructHashTable(size_t reserve = 0) {
+    size_t capacity = MIN_CAPACITY;
+    while (capacity < reserve) {
+      capacity <<= 1;
+    }
+    _entries.resize(capacity);
+  }
+
+  /// Computes the hash code of the node signature: the inputs of
+  /// a commutative function are considered as a multiset.
+  static uint64_t hash(uint32_t netId, F func, const SignalList &inputs) {
+    uint64_t ihash = 0;
     if (func.isCommutative()) {
-      std::sort(hashes.begin(), hashes.end());
+      for (const auto &input : inputs) {
+        ihash += mix(signal(input));
+      }
+    } else {
+      for (const auto &input : inputs) {
+        ihash = mix(ihash ^ signal(input));
+      }
     }
 
-    const uint64_t prime = 37;
+    const uint64_t head = (static_cast<uint64_t>(netId) << 32)
+                        | (static_cast<uint64_t>(func) << 16)
+                        | (static_cast<uint64_t>(inputs.size()) & 0xffff);
 
-    ihash = 0;
-    for (const auto hash : hashes) {
-      ihash *= prime;
-      ihash += hash;
+    return mix(mix(head) ^ ihash);
+  }
+
+  /// Returns the node that has the given hash code and satisfies
+  /// the predicate (or EMPTY).
+  template <typename Equal>
+  N find(uint64_t hash, uint32_t netId, Equal equal) const {
+    const size_t mask = _entries.size() - 1;
+
+    uint64_t probes = 0;
+    N result = EMPTY;
+
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+      const auto &entry = _entries[i];
+      probes++;
+
+      if (entry.node == EMPTY) {
+        break;
+      }
+      if (entry.hash == hash && entry.netId == netId && equal(entry.node)) {
+        result = entry.node;
+        break;
+      }
     }
+
+    _stats.lookups++;
+    _stats.hits += (result != EMPTY);
+    _stats.probes += probes;
+    _stats.maxProbes = std::max(_stats.maxProbes, probes);
+
+    return result;
   }
 
-  /// Compares this key w/ the given one.
-  constexpr bool operator ==(const NodeHashKey &rhs) const {
-    return netId == rhs.netId
-        && func  == rhs.func
-        && arity == rhs.arity
-        && ihash == rhs.ihash;
+  /// Inserts the entry into the table.
+  void insert(uint64_t hash, uint32_t netId, N node) {
+    if (2 * (_size + 1) > _entries.size()) {
+      rehash(2 * _entries.size());
+    }
+
+    place(Entry{hash, netId, node});
+    _size++;
   }
 
-  /// Network identifier (exact).
-  uint32_t netId;
-  /// Functional symbol (exact).
-  uint16_t func;
-  /// Node arity (exact).
-  uint16_t arity;
-  /// Hash code(s) of node inputs.
-  uint64_t ihash;
-};
+  /// Removes the entry from the table (returns false if there is no such).
+  bool erase(uint64_t hash, uint32_t netId, N node) {
+    const size_t mask = _entries.size() - 1;
+
+    size_t i = hash & mask;
+    for (;; i = (i + 1) & mask) {
+      const auto &entry = _entries[i];
+      if (entry.node == EMPTY) {
+        return false;
+      }
+      if (entry.node == node && entry.netId == netId && entry.hash == hash) {
+        break;
+      }
+    }
 
-} // namespace eda::base::model
+    // The following entries of the cluster are shifted back unless
+    // their home positions are in (i, j].
+    for (size_t j = (i + 1) & mask; _entries[j].node != EMPTY;
+         j = (j + 1) & mask) {
+      const size_t home = _entries[j].hash & mask;
+      const bool stays = (i <= j) ? (i < home && home <= j)
+                                  : (i < home || home <= j);
+      if (!stays) {
+        _entries[i] = _entries[j];
+        i = j;
+      }
+    }
 
-//===----------------------------------------------------------------------===//
-// Hash
-//===----------------------------------------------------------------------===//
+    _entries[i] = Entry();
+    _size--;
+    return true;
+  }
 
-namespace std {
+  /// Returns the number of entries.
+  size_t size() const { return _size; }
+  /// Returns the lookup statistics.
+  const Stats &stats() const { return _stats; }
+  /// Resets the lookup statistics.
+  void resetStats() { _stats = Stats(); }
+
+private:
+  static constexpr size_t MIN_CAPACITY = 1024;
+
+  struct Entry final {
+    uint64_t hash = 0;
+    uint32_t netId = 0;
+    N node = EMPTY;
+  };
+
+  /// Packs the signal into an integer.
+  static uint64_t signal(const Signal &input) {
+    return (static_cast<uint64_t>(input.event()) << 32) | input.node();
+  }
 
-/**
- * \brief Implements hash code computation for NodeHashKey.
- * \author <a href="mailto:kamkin@ispras.ru">Alexander Kamkin</a>
- */
-template <typename F, typename N>
-struct hash<eda::base::model::NodeHashKey<F, N>> {
-  size_t operator()(const eda::base::model::NodeHashKey<F, N> &key) const {
-    const size_t prime = 37;
-
-    size_t hash = key.netId;
-    hash *= prime;
-    hash += key.func;
-    hash *= prime;
-    hash += key.arity;
-    hash *= prime;
-    hash += key.ihash;
-
-    return hash;
+  /// Mixes the bits of the integer (splitmix64 finalizer).
+  static uint64_t mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+  }
+
+  void place(const Entry &entry) {
+    const size_t mask = _entries.size() - 1;
+
+    size_t i = entry.hash & mask;
+    while (_entries[i].node != EMPTY) {
+      i = (i + 1) & mask;
+    }
+    _entries[i] = entry;
+  }
+
+  void rehash(size_t capacity) {
+    std::vector<Entry> entries(capacity);
+    std::swap(entries, _entries);
+
+    for (const auto &entry : entries) {
+      if (entry.node != EMPTY) {
+        place(entry);
+      }
+    }
   }
+
+  std::vector<Entry> _entries;
+  size_t _size = 0;
+
+  mutable Stats _stats;
 };
 
-} // namespace std
+} // namespace eda::base::model
@@ -8,18 +8,25 @@
 
 #pragma once
 
+#include "base/model/arena.h"
 #include "base/model/hash.h"
 #include "base/model/link.h"
 #include "base/model/signal.h"
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
+#include <thread>
+#include <typeindex>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 namespace eda::base::model {
 
+/// Identifier of the main thread (the only one allowed to use the default
+/// node store implicitly).
+inline const std::thread::id mainThreadId = std::this_thread::get_id();
+
 /**
  * \brief Represents a net node (a gate or a higher-level unit).
  * \author <a href="mailto:kamkin@ispras.ru">Alexander Kamkin</a>
@@ -40,17 +47,125 @@ public:
   using LinkList = Link::List;
   using Signal = eda::base::model::Signal<Id>;
   using SignalList = Signal::List;
-  using StructHashKey = NodeHashKey<Func, Id>;
-  using StructHashMap = std::unordered_map<StructHashKey, Id>;
+  using StructHashTable = eda::base::model::StructHashTable<Func, Id>;
+  using StructHashStats = typename StructHashTable::Stats;
+
+  //===--------------------------------------------------------------------===//
+  // Store
+  //===--------------------------------------------------------------------===//
+
+  /**
+   * \brief Owns the nodes of a design and the structural hashing table.
+   *
+   * The nodes are created in the store that is current for the calling
+   * thread (see Scope); if no store is activated, the default one is used.
+   * Only the main thread may use the default store implicitly: the other
+   * threads must activate a store (this is asserted), since the node
+   * identifiers are local to the store and would be resolved against
+   * a wrong one.
+   *
+   * The memory is reclaimed only when the store is destroyed: the nodes
+   * removed from the nets (and their identifiers) are kept until then.
+   * So the memory consumption is bounded by creating a store per design
+   * (or per flow step) rather than by reusing the default store.
+   */
+  class Store final {
+  public:
+    explicit Store(size_t reserve = 0): hashing(reserve) {
+      storage.reserve(reserve);
+    }
+
+    Store(const Store &) = delete;
+    Store &operator =(const Store &) = delete;
+
+    ~Store() {
+      // The store-local objects may refer to the nodes.
+      locals.clear();
+      // The destructor is virtual: the derived nodes' members are released.
+      for (auto *node : storage) {
+        node->~Node();
+      }
+    }
+
+    /// Returns the number of nodes.
+    size_t size() const { return storage.size(); }
+
+    /// Returns the number of structural hashing entries.
+    size_t hashSize() const { return hashing.size(); }
+    /// Returns the structural hashing statistics.
+    const StructHashStats &hashStats() const { return hashing.stats(); }
+    /// Resets the structural hashing statistics.
+    void resetHashStats() { hashing.resetStats(); }
+
+    /// Returns the store-local object of the given type (creates it if
+    /// required). The object is destroyed together with the store.
+    template <typename T>
+    T &local() {
+      auto &object = locals[std::type_index(typeid(T))];
+      if (!object) {
+        object = std::make_shared<T>();
+      }
+      return *std::static_pointer_cast<T>(object);
+    }
+
+    /// Activates the store for the current thread within a scope.
+    class Scope final {
+    public:
+      explicit Scope(Store &store): _previous(current()) {
+        current() = &store;
+      }
+
+      ~Scope() { current() = _previous; }
+
+      Scope(const Scope &) = delete;
+      Scope &operator =(const Scope &) = delete;
+
+    private:
+      Store *_previous;
+    };
+
+  private:
+    friend class Node<Func, StructHash>;
+
+    /// Returns the store activated for the current thread (or nullptr).
+    static Store *&current() {
+      thread_local Store *store = nullptr;
+      return store;
+    }
+
+    /// Nodes (indexed by identifiers).
+    List storage;
+    /// Structural hashing.
+    StructHashTable hashing;
+    /// Memory for the nodes.
+    Arena arena;
+    /// Store-local objects.
+    std::unordered_map<std::type_index, std::shared_ptr<void>> locals;
+  };
+
+  /// Returns the store of the current thread.
+  static Store &store() {
+    auto *current = Store::current();
+    assert((current != nullptr || std::this_thread::get_id() == mainThreadId)
+        && "No node store is activated for the thread");
+    return current != nullptr ? *current : defaultStore();
+  }
+
+  /// Returns the default store.
+  static Store &defaultStore() {
+    // The default store is never destroyed.
+    static Store *store = new Store(1024*1024);
+    return *store;
+  }
 
   //===--------------------------------------------------------------------===//
   // Accessor
   //===--------------------------------------------------------------------===//
 
   /// Returns the node w/ the given id from the storage.
-  static Node<Func, StructHash> *get(Id id) { return _storage[id]; }
+  static Node<Func, StructHash> *get(Id id) { return store().storage[id]; }
   /// Returns the next node identifier.
-  static Id nextId() { return _storage.size(); }
+  static Id nextId() { return store().storage.size(); }
 
   /// Returns the node w/ the given function/inputs from the storage.
   static Node<Func, StructHash> *get(
@@ -58,6 +173,10 @@ public:
   /// Saves the node w/ the given function/inputs to the hash table.
   static void add(
       uint32_t netId, Node<Func, StructHash> *node);
+  /// Removes the node from the hash table (must be called before the
+  /// node's function/inputs are changed).
+  static void remove(
+      uint32_t netId, Node<Func, StructHash> *node);
 
   //===--------------------------------------------------------------------===//
   // Properties
@@ -66,18 +185,38 @@ public:
   Id id() const { return _id; }
   Func func() const { return _func; }
 
-  bool hasSignature(Func func, const SignalList &inputs) {
+  /// Checks whether the node has the given function and inputs
+  /// (the inputs of a commutative function are compared as multisets).
+  bool hasSignature(Func func, const SignalList &inputs) const {
     if (func != _func || inputs.size() != _inputs.size()) {
       return false;
     }
 
-    std::unordered_set<Id> inputSet;
-    for (size_t i = 0; i < inputs.size(); i++) {
-      inputSet.insert(inputs[i].node());
-      inputSet.insert(_inputs[i].node());
+    if (!func.isCommutative()) {
+      return std::equal(inputs.begin(), inputs.end(), _inputs.begin());
     }
 
-    return inputSet.size() == inputs.size();
+    // Quadratic comparison for small arities (no allocation).
+    if (inputs.size() <= 16) {
+      for (const auto &input : inputs) {
+        const auto n = std::count(inputs.begin(), inputs.end(), input);
+        if (std::count(_inputs.begin(), _inputs.end(), input) != n) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    const auto less = [](const Signal &lhs, const Signal &rhs) {
+      return lhs.node() != rhs.node() ? lhs.node() < rhs.node()
+                                      : lhs.event() < rhs.event();
+    };
+
+    SignalList lhs(inputs), rhs(_inputs);
+    std::sort(lhs.begin(), lhs.end(), less);
+    std::sort(rhs.begin(), rhs.end(), less);
+
+    return lhs == rhs;
   }
 
   //===--------------------------------------------------------------------===//
@@ -102,15 +241,32 @@ public:
   Signal level1()  const { return Signal::level1(_id); }
   Signal always()  const { return Signal::always(_id); }
 
+  //===--------------------------------------------------------------------===//
+  // Allocation
+  //===--------------------------------------------------------------------===//
+
+  /// Allocates the node in the arena (nodes are never deallocated).
+  static void *operator new(size_t size) {
+    return store().arena.allocate(size);
+  }
+  /// Constructs the node in the existing position.
+  static void *operator new(size_t size, void *ptr) { return ptr; }
+  /// Does nothing: the memory is released together with the store.
+  static void operator delete(void *ptr) {}
+
 protected:
+  /// Destroys the node (called by the store that owns the memory).
+  virtual ~Node() = default;
+
   /// Creates a node w/ the given function/inputs and
   /// allocates this node in the storage.
   Node(Func func, const SignalList &inputs):
-    _id(_storage.size()), _func(func), _inputs(inputs) {
+    _id(nextId()), _func(func), _inputs(inputs) {
     // Register the node in the storage.
-    if (_id >= _storage.size()) {
-      _storage.resize(_id + 1);
-      _storage[_id] = this;
+    auto &storage = store().storage;
+    if (_id >= storage.size()) {
+      storage.resize(_id + 1);
+      storage[_id] = this;
     }
     appendLinks();
   }
@@ -119,8 +275,9 @@ protected:
   /// stores this node in the existing position.
   Node(Id id, Func func, const SignalList &inputs, const LinkList &links):
     _id(id), _func(func), _inputs(inputs), _links(links) {
-    assert(_id < _storage.size());
-    _storage[_id] = this;
+    auto &storage = store().storage;
+    assert(_id < storage.size());
+    storage[_id] = this;
     appendLinks();
   }
 
@@ -164,10 +321,6 @@ protected:
   SignalList _inputs;
   LinkList _links;
 
-  /// Node storage.
-  static List _storage;
-  /// Structural hashing.
-  static StructHashMap _hashing;
 };
 
 template <typename Func, bool StructHash>
@@ -190,18 +343,12 @@ Node<Func, StructHash> *Node<Func, StructHash>::get(
   }
 
   // Search for the same node.
-  StructHashKey key(netId, func, inputs);
-  auto i = _hashing.find(key);
-
-  // If the same node exists, return it.
-  if (i != _hashing.end()) {
-    auto *node = get(i->second);
-    if (node->hasSignature(func, inputs)) {
-      return node;
-    }
-  }
+  const auto hash = StructHashTable::hash(netId, func, inputs);
+  const auto id = store().hashing.find(hash, netId, [&](Id id) {
+    return get(id)->hasSignature(func, inputs);
+  });
 
-  return nullptr;
+  return id != StructHashTable::EMPTY ? get(id) : nullptr;
 }
 
 template <typename Func, bool StructHash>
@@ -211,22 +358,20 @@ void Node<Func, StructHash>::add(uint32_t netId, Node<Func, StructHash> *node) {
     return;
   }
 
-  StructHashKey key(netId, node->func(), node->inputs());
-  _hashing.insert({key, node->id()});
+  const auto hash = StructHashTable::hash(netId, node->func(), node->inputs());
+  store().hashing.insert(hash, netId, node->id());
 }
 
 template <typename Func, bool StructHash>
-typename Node<Func, StructHash>::List Node<Func, StructHash>::_storage = []{
-  Node<Func, StructHash>::List storage;
-  storage.reserve(1024*1024);
-  return storage;
-}();
+void Node<Func, StructHash>::remove(
+    uint32_t netId, Node<Func, StructHash> *node) {
+  // Structural hashing is disabled.
+  if constexpr(!StructHash) {
+    return;
+  }
 
-template <typename Func, bool StructHash>
-typename Node<Func, StructHash>::StructHashMap Node<Func, StructHash>::_hashing = []{
-  Node<Func, StructHash>::StructHashMap hashing;
-  hashing.reserve(1024*1024);
-  return hashing;
-}();
+  const auto hash = StructHashTable::hash(netId, node->func(), node->inputs());
+  store().hashing.erase(hash, netId, node->id());
+}
 
 } // namespace eda::base::model
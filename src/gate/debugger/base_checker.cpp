@@ -8,7 +8,10 @@
 
 #include "base_checker.h"
 #include "bdd_checker.h"
+#include "bmc_checker.h"
 #include "checker.h"
+#include "fraig_checker.h"
+#include "parallel_checker.h"
 #include "rnd_checker.h"
 
 namespace eda::gate::debugger {
@@ -18,7 +21,10 @@ using LecType = eda::gate::debugger::options::LecType;
 BaseChecker &getChecker(LecType lec) {
   switch(lec) {
     case LecType::BDD: return BddChecker::get();
+    case LecType::BMC: return BmcChecker::get();
     case LecType::DEFAULT: return Checker::get();
+    case LecType::FRAIG: return FraigChecker::get();
+    case LecType::PARALLEL: return ParallelChecker::get();
     case LecType::RND: return RndChecker::get();
     default: return Checker::get();
   }
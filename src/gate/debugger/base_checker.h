@@ -14,7 +14,10 @@ namespace eda::gate::debugger::options {
 
 enum LecType {
   BDD,
+  BMC,
   DEFAULT,
+  FRAIG,
+  PARALLEL,
   RND,
 };
 
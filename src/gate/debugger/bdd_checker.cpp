@@ -7,9 +7,20 @@
 //===----------------------------------------------------------------------===//
 
 #include "gate/debugger/bdd_checker.h"
+#include "gate/debugger/encoder.h"
+#include "gate/model/garray.h"
+
+#include <exception>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace eda::gate::debugger {
 
+using GArray = model::GArray;
+using Index = GArray::Index;
+
 bool bddChecker(GNet &net1, GNet &net2, Hints &hints) {
 
   GNet *miterNet = miter(net1, net2, hints);
@@ -39,36 +50,249 @@ bool bddChecker(GNet &net1, GNet &net2, Hints &hints) {
   return (netBDD == manager.bddZero());
 } 
 
+namespace {
+
+/**
+ * \brief Net snapshot w/ the working storage for building the cone BDDs.
+ */
+struct ConeNet final {
+  explicit ConeNet(const GNet &net):
+      array(net),
+      stamp(array.nGates(), 0),
+      refs(array.nGates(), 0),
+      bdds(array.nGates()) {}
+
+  /// Collects the cone of the gate in topological order (depth-first).
+  void collect(Index output, std::vector<Index> &cone) {
+    epoch++;
+
+    // The flag indicates whether the gate fanins have been pushed.
+    std::vector<std::pair<Index, bool>> stack;
+    stack.push_back({output, false});
+
+    while (!stack.empty()) {
+      const auto [i, expanded] = stack.back();
+
+      if (expanded) {
+        stack.pop_back();
+        cone.push_back(i);
+      } else if (stamp[i] == epoch) {
+        stack.pop_back();
+      } else {
+        stamp[i] = epoch;
+        stack.back().second = true;
+
+        // The first fanin is visited first (the external ones are skipped).
+        for (std::size_t j = array.arity(i); j > 0; j--) {
+          const auto k = array.fanin(i, j - 1);
+          if (k != GArray::EXTERNAL && stamp[k] != epoch) {
+            stack.push_back({k, false});
+          }
+        }
+      }
+    }
+  }
+
+  const GArray array;
+
+  /// Visit marks.
+  std::vector<unsigned> stamp;
+  unsigned epoch = 0;
+
+  /// Numbers of the unprocessed fanouts within the cone.
+  std::vector<unsigned> refs;
+  /// BDDs of the gates (dense map).
+  std::vector<BDD> bdds;
+};
+
+/**
+ * \brief Builds the BDDs of the output cones w/ a cone-local manager.
+ */
+class ConeBuilder final {
+public:
+  ConeBuilder(std::size_t nodeLimit, bool reordering):
+      manager(0, 0), nodeLimit(nodeLimit) {
+    if (reordering) {
+      manager.AutodynEnable(CUDD_REORDER_SIFT);
+    }
+  }
+
+  /// Builds the BDD of the gate's cone; the inputs are renamed according
+  /// to the connection map. The variables are the source gates of the cone
+  /// and the fanins that do not belong to the net (the latter are shared by
+  /// the nets). Returns false if the node limit is exceeded.
+  bool build(ConeNet &net,
+             Index output,
+             const Context::GateConnect *connectTo,
+             BDD &result) {
+    const auto &array = net.array;
+
+    std::vector<Index> cone;
+    net.collect(output, cone);
+
+    for (const auto i : cone) {
+      for (std::size_t j = 0; j < array.arity(i); j++) {
+        const auto k = array.fanin(i, j);
+        if (k != GArray::EXTERNAL) {
+          net.refs[k]++;
+        }
+      }
+    }
+
+    try {
+      BddList inputs;
+      for (const auto i : cone) {
+        if (array.isSource(i) || (array.arity(i) == 0 && !array.isValue(i))) {
+          net.bdds[i] = var(connectedTo(connectTo, array.id(i)));
+        } else {
+          inputs.resize(array.arity(i));
+          for (std::size_t j = 0; j < inputs.size(); j++) {
+            const auto k = array.fanin(i, j);
+            if (k == GArray::EXTERNAL) {
+              inputs[j] = var(connectedTo(connectTo, array.faninId(i, j)));
+              continue;
+            }
+
+            inputs[j] = net.bdds[k];
+
+            // The BDD is freed as soon as all its fanouts are built.
+            if (--net.refs[k] == 0) {
+              net.bdds[k] = BDD();
+            }
+          }
+
+          net.bdds[i] = GNetBDDConverter::applyGateFunc(
+              array.func(i), inputs, manager);
+          inputs.clear();
+        }
+
+        if (getLiveNodes() > nodeLimit) {
+          release(net, cone);
+          return false;
+        }
+      }
+    } catch (const std::exception &) {
+      // The default CUDD error handler throws (e.g., if out of memory).
+      release(net, cone);
+      return false;
+    }
+
+    result = net.bdds[output];
+    net.bdds[output] = BDD();
+    return true;
+  }
+
+private:
+  /// Returns the number of live nodes. Cudd_ReadNodeCount() is not used,
+  /// since it flushes the death row and scans all the variables, which is
+  /// too slow to be called per gate.
+  std::size_t getLiveNodes() const {
+    return manager.ReadKeys() - manager.ReadDead();
+  }
+
+  /// Frees the BDDs of the cone.
+  static void release(ConeNet &net, const std::vector<Index> &cone) {
+    for (const auto k : cone) {
+      net.refs[k] = 0;
+      net.bdds[k] = BDD();
+    }
+  }
+
+  static GateId connectedTo(const Context::GateConnect *connectTo,
+                            GateId gateId) {
+    if (connectTo) {
+      const auto i = connectTo->find(gateId);
+      if (i != connectTo->end()) {
+        return i->second;
+      }
+    }
+    return gateId;
+  }
+
+  /// Returns the input variable (the variables are created in the order
+  /// of the requests, which gives the structural order).
+  BDD var(GateId inputId) {
+    const auto i = vars.find(inputId);
+    if (i != vars.end()) {
+      return i->second;
+    }
+
+    BDD x = manager.bddVar();
+    vars.emplace(inputId, x);
+    return x;
+  }
+
+  Cudd manager;
+  const std::size_t nodeLimit;
+  std::unordered_map<GateId, BDD> vars;
+};
+
+} // namespace
+
 bool BddChecker::areEqual(GNet &lhs,
                           GNet &rhs,
                           Checker::GateIdMap &gmap) {
+  if (!lhs.isComb() || !rhs.isComb()) {
+    return Checker::get().areEqual(lhs, rhs, gmap);
+  }
 
-  GateBinding ibind, obind, tbind;
+  stats = Stats();
 
-  // Input-to-input correspondence.
-  for (auto oldSourceLink : lhs.sourceLinks()) {
-    auto newSourceId = gmap[oldSourceLink.target];
-    ibind.insert({oldSourceLink, Gate::Link(newSourceId)});
+  // The RHS inputs are substituted by the LHS ones (the external sources
+  // that are not mapped are shared by the nets).
+  Context::GateConnect connectTo;
+  for (const auto &sourceLink : lhs.sourceLinks()) {
+    const auto i = gmap.find(sourceLink.source);
+    if (i != gmap.end()) {
+      connectTo[i->second] = sourceLink.source;
+    }
   }
 
-  // Output-to-output correspondence.
-  for (auto oldTargetLink : lhs.targetLinks()) {
-    auto newTargetId = gmap[oldTargetLink.source];
-    obind.insert({oldTargetLink, Gate::Link(newTargetId)});
-  }
+  ConeNet lhsNet(lhs);
+  ConeNet rhsNet(rhs);
 
-  // Trigger-to-trigger correspondence.
-  for (auto oldTriggerId : lhs.triggers()) {
-    auto newTriggerId = gmap[oldTriggerId];
-    tbind.insert({Gate::Link(oldTriggerId), Gate::Link(newTriggerId)});
-  }
+  // The SAT encoder is created on demand.
+  std::unique_ptr<Encoder> encoder;
+
+  for (const auto &targetLink : lhs.targetLinks()) {
+    const auto lhsOutputId = targetLink.source;
+    const auto rhsOutputId = gmap[lhsOutputId];
+
+    {
+      ConeBuilder builder(nodeLimit, reordering);
+
+      BDD x, y;
+      if (builder.build(lhsNet, lhsNet.array.index(lhsOutputId), nullptr, x)
+       && builder.build(rhsNet, rhsNet.array.index(rhsOutputId), &connectTo, y)) {
+        stats.nBdd++;
+        if (x != y) {
+          return false;
+        }
+        continue;
+      }
+    }
+
+    // The node limit is exceeded: fall back to SAT.
+    stats.nSat++;
+    if (!encoder) {
+      encoder = std::make_unique<Encoder>();
+      encoder->setConnectTo(&connectTo);
+    }
+
+    encoder->encodeCone(*Gate::get(lhsOutputId), 0);
+    encoder->encodeCone(*Gate::get(rhsOutputId), 0);
 
-  Checker::Hints hints;
-  hints.sourceBinding  = std::make_shared<GateBinding>(std::move(ibind));
-  hints.targetBinding  = std::make_shared<GateBinding>(std::move(obind));
-  hints.triggerBinding = std::make_shared<GateBinding>(std::move(tbind));
+    Context::Clause assumptions;
+    assumptions.push(encoder->encodeDiff({{encoder->var(lhsOutputId, 0),
+                                           encoder->var(rhsOutputId, 0)}}));
+
+    if (encoder->solve(assumptions)) {
+      return false;
+    }
+    encoder->release(assumptions[0]);
+  }
 
-  return (bddChecker(lhs, rhs, hints));
+  return true;
 }
 
 } // namespace eda::gate::debugger
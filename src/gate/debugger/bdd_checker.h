@@ -11,6 +11,8 @@
 #include "gate/debugger/miter.h"
 #include "gate/transformer/bdd.h"
 
+#include <cstddef>
+
 namespace eda::gate::debugger {
 
 using BddList = transformer::GNetBDDConverter::BDDList;
@@ -34,14 +36,49 @@ using SignalList = model::Gate::SignalList;
  */
 bool bddChecker(GNet &net1, GNet &net2, Hints &hints);
 
+/**
+ * \brief Implements a BDD-based LEC of combinational nets.
+ *
+ * Each output pair is checked in its own cone w/ a cone-local CUDD manager.
+ * The variables are ordered structurally (in the order the inputs are
+ * reached by the depth-first traversal of the cones), dynamic sifting is
+ * enabled, and an intermediate BDD is freed as soon as all its fanouts
+ * are built. If the number of live nodes exceeds the limit (or CUDD fails,
+ * e.g. runs out of memory), the output pair is checked by the SAT solver.
+ */
 class BddChecker : public BaseChecker, public util::Singleton<BddChecker> {
 friend class util::Singleton<BddChecker>;
 
 public:
+  /// Default limit on the number of live BDD nodes.
+  static constexpr std::size_t DEFAULT_NODE_LIMIT = 1000000;
+
+  /// Checking statistics.
+  struct Stats final {
+    /// Number of the output pairs decided by BDDs.
+    std::size_t nBdd = 0;
+    /// Number of the output pairs checked by SAT (the node limit exceeded).
+    std::size_t nSat = 0;
+  };
+
   bool areEqual(GNet &lhs,
                 GNet &rhs,
                 Checker::GateIdMap &gmap) override;
 
+  /// Sets the limit on the number of live BDD nodes per output pair.
+  void setNodeLimit(std::size_t nodeLimit) { this->nodeLimit = nodeLimit; }
+
+  /// Enables/disables the dynamic variable reordering (sifting).
+  void setReordering(bool reordering) { this->reordering = reordering; }
+
+  /// Returns the statistics of the last check.
+  const Stats &getStats() const { return stats; }
+
+private:
+  std::size_t nodeLimit = DEFAULT_NODE_LIMIT;
+  bool reordering = true;
+
+  Stats stats;
 };
 
 } // namespace eda::gate::debugger
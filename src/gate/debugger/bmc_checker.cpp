@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/bmc_checker.h"
+#include "gate/debugger/symexec.h"
+
+#include <cassert>
+#include <vector>
+
+namespace eda::gate::debugger {
+
+bool BmcChecker::areEqual(GNet &lhs,
+                          GNet &rhs,
+                          GateIdMap &gmap) {
+  return findDivergence(lhs, rhs, gmap) == NO_DIVERGENCE;
+}
+
+unsigned BmcChecker::findDivergence(const GNet &lhs,
+                                    const GNet &rhs,
+                                    const GateIdMap &gmap,
+                                    unsigned depth) const {
+  GateBinding ibind, obind;
+
+  for (const auto &sourceLink : lhs.sourceLinks()) {
+    ibind.insert({sourceLink, Gate::Link(gmap.at(sourceLink.target))});
+  }
+
+  for (const auto &targetLink : lhs.targetLinks()) {
+    obind.insert({targetLink, Gate::Link(gmap.at(targetLink.source))});
+  }
+
+  return findDivergence(lhs, rhs, ibind, obind, depth);
+}
+
+unsigned BmcChecker::findDivergence(const GNet &lhs,
+                                    const GNet &rhs,
+                                    const GateBinding &ibind,
+                                    const GateBinding &obind,
+                                    unsigned depth) const {
+  assert(lhs.nSourceLinks() == rhs.nSourceLinks());
+
+  // The RHS inputs are substituted by the LHS ones in every frame.
+  Context::GateConnect connectTo;
+  for (const auto &[lhsGateLink, rhsGateLink] : ibind) {
+    connectTo[rhsGateLink.source] = lhsGateLink.source;
+  }
+
+  SymbolicExecutor executor;
+  auto &encoder = executor.encoder();
+  encoder.setConnectTo(&connectTo);
+
+  // The trigger values of version 0 form the initial state.
+  for (const auto *net : {&lhs, &rhs}) {
+    for (const auto triggerId : net->triggers()) {
+      encoder.encodeFix(encoder.var(triggerId, 0), false);
+    }
+  }
+
+  std::vector<Encoder::VarPair> outputs;
+  outputs.reserve(obind.size());
+
+  for (unsigned i = 0; i < depth; i++) {
+    // Unroll the next frame.
+    executor.exec(lhs);
+    executor.exec(rhs);
+
+    const auto version = executor.cycle();
+
+    outputs.clear();
+    for (const auto &[lhsGateLink, rhsGateLink] : obind) {
+      outputs.push_back({encoder.var(lhsGateLink.source, version),
+                         encoder.var(rhsGateLink.source, version)});
+    }
+
+    Context::Clause assumptions;
+    assumptions.push(encoder.encodeDiff(outputs));
+
+    if (encoder.solve(assumptions)) {
+      return i;
+    }
+
+    // The frame's clauses (and the learnt ones) are kept.
+    encoder.release(assumptions[0]);
+    executor.tick();
+  }
+
+  return NO_DIVERGENCE;
+}
+
+} // namespace eda::gate::debugger
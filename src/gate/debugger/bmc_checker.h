@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "gate/debugger/base_checker.h"
+#include "gate/debugger/checker.h"
+#include "gate/model/gnet.h"
+#include "util/singleton.h"
+
+namespace eda::gate::debugger {
+
+/**
+ * \brief Implements a bounded model checking (BMC) LEC of sequential nets.
+ *
+ * No correspondence between the triggers is required. Both nets are
+ * unrolled from the reset state (all the triggers are zero) into a single
+ * incremental SAT instance, one frame per step. At each step, the outputs
+ * of the new frame are compared under an activation literal, so the learnt
+ * clauses are reused between the depths. The check stops at the first
+ * cycle where the outputs diverge or when the depth bound is reached.
+ * The checker has no state: the depth is passed to each check.
+ */
+class BmcChecker final : public BaseChecker,
+                         public util::Singleton<BmcChecker> {
+  friend class util::Singleton<BmcChecker>;
+
+public:
+  using GateBinding = Checker::GateBinding;
+  using GateIdMap = Checker::GateIdMap;
+
+  /// Default number of the unrolled cycles.
+  static constexpr unsigned DEFAULT_DEPTH = 16;
+  /// Returned by findDivergence() if the outputs have not diverged.
+  static constexpr unsigned NO_DIVERGENCE = -1u;
+
+  /// Checks that the nets' outputs coincide in the first DEFAULT_DEPTH
+  /// cycles.
+  bool areEqual(GNet &lhs,
+                GNet &rhs,
+                GateIdMap &gmap) override;
+
+  /// Checks that the nets' outputs coincide in the first depth cycles.
+  bool areEqual(const GNet &lhs,
+                const GNet &rhs,
+                const GateBinding &ibind,
+                const GateBinding &obind,
+                unsigned depth = DEFAULT_DEPTH) const {
+    return findDivergence(lhs, rhs, ibind, obind, depth) == NO_DIVERGENCE;
+  }
+
+  /// Returns the first cycle (starting from 0) where the nets' outputs
+  /// diverge or NO_DIVERGENCE if they coincide in the first depth cycles.
+  unsigned findDivergence(const GNet &lhs,
+                          const GNet &rhs,
+                          const GateIdMap &gmap,
+                          unsigned depth = DEFAULT_DEPTH) const;
+
+  /// Returns the first cycle (starting from 0) where the nets' outputs
+  /// diverge or NO_DIVERGENCE if they coincide in the first depth cycles.
+  unsigned findDivergence(const GNet &lhs,
+                          const GNet &rhs,
+                          const GateBinding &ibind,
+                          const GateBinding &obind,
+                          unsigned depth = DEFAULT_DEPTH) const;
+
+private:
+  BmcChecker() {}
+};
+
+} // namespace eda::gate::debugger
@@ -6,6 +6,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "gate/debugger/bmc_checker.h"
 #include "gate/debugger/checker.h"
 #include "gate/debugger/encoder.h"
 #include "gate/simulator/simulator.h"
@@ -31,25 +32,37 @@ bool Checker::areEqual(GNet &lhs,
     obind.insert({oldTargetLink, Gate::Link(newTargetId)});
   }
 
-  // Trigger-to-trigger correspondence.
+  // Trigger-to-trigger correspondence (if known).
+  bool isKnownTriggerBinding = true;
   for (auto oldTriggerId : lhs.triggers()) {
-    auto newTriggerId = gmap[oldTriggerId];
-    tbind.insert({Gate::Link(oldTriggerId), Gate::Link(newTriggerId)});
+    auto i = gmap.find(oldTriggerId);
+    if (i == gmap.end()) {
+      isKnownTriggerBinding = false;
+      break;
+    }
+    tbind.insert({Gate::Link(oldTriggerId), Gate::Link(i->second)});
   }
 
   Checker::Hints hints;
   hints.sourceBinding  = std::make_shared<GateBinding>(std::move(ibind));
   hints.targetBinding  = std::make_shared<GateBinding>(std::move(obind));
-  hints.triggerBinding = std::make_shared<GateBinding>(std::move(tbind));
+  if (isKnownTriggerBinding) {
+    hints.triggerBinding = std::make_shared<GateBinding>(std::move(tbind));
+  }
 
   return areEqual(lhs, rhs, hints);
 }
 
 bool Checker::areEqual(const GNet &lhs,
                        const GNet &rhs,
-                       const Hints &hints) const {
+                       const Hints &hints,
+                       Counterexample *counterexample) const {
   const unsigned flatCheckBound = 64 * 1024;
 
+  if (counterexample) {
+    *counterexample = Counterexample();
+  }
+
   assert(hints.isKnownIoPortBinding());
   assert(lhs.nSourceLinks() == rhs.nSourceLinks());
   assert(lhs.nSourceLinks() <= hints.sourceBinding->size());
@@ -65,14 +78,16 @@ bool Checker::areEqual(const GNet &lhs,
   if (lhs.isComb() && rhs.isComb()) {
     return areEqualComb(lhs, rhs,
                        *hints.sourceBinding,
-                       *hints.targetBinding);
+                       *hints.targetBinding,
+                       counterexample);
   }
 
   if (hints.isKnownTriggerBinding()) {
     return areEqualSeq(lhs, rhs,
                       *hints.sourceBinding,
                       *hints.targetBinding,
-                      *hints.triggerBinding);
+                      *hints.triggerBinding,
+                      counterexample);
   }
 
   if (hints.isKnownStateEncoding()) {
@@ -84,11 +99,14 @@ bool Checker::areEqual(const GNet &lhs,
                       *hints.lhsTriEncIn,
                       *hints.lhsTriDecOut,
                       *hints.rhsTriEncOut,
-                      *hints.rhsTriDecIn);
+                      *hints.rhsTriDecIn,
+                      counterexample);
   }
 
-  assert(false && "Unimplemented LEC");
-  return false;
+  // Bounded check from the reset state.
+  return BmcChecker::get().areEqual(lhs, rhs,
+                                    *hints.sourceBinding,
+                                    *hints.targetBinding);
 }
 
 bool Checker::areEqualHier(const GNet &lhs,
@@ -138,21 +156,24 @@ bool Checker::areEqualHier(const GNet &lhs,
 bool Checker::areEqualComb(const GNet &lhs,
                            const GNet &rhs,
                            const GateBinding &ibind,
-                           const GateBinding &obind) const {
+                           const GateBinding &obind,
+                           Counterexample *counterexample) const {
   const unsigned simCheckBound = 8;
 
   if (lhs.nSourceLinks() <= simCheckBound) {
-    return areEqualCombSim(lhs, rhs, ibind, obind);
+    return areEqualCombSim(lhs, rhs, ibind, obind, counterexample);
   }
 
-  return areEqualCombSat({ &lhs, &rhs }, nullptr, ibind, obind);
+  return areEqualCombSat({ &lhs, &rhs }, nullptr, ibind, obind,
+                         counterexample);
 }
 
 bool Checker::areEqualSeq(const GNet &lhs,
                           const GNet &rhs,
                           const GateBinding &ibind,
                           const GateBinding &obind,
-                          const GateBinding &tbind) const {
+                          const GateBinding &tbind,
+                          Counterexample *counterexample) const {
   GateBinding imap(ibind);
   GateBinding omap(obind);
 
@@ -174,7 +195,7 @@ bool Checker::areEqualSeq(const GNet &lhs,
     }
   }
 
-  return areEqualComb(lhs, rhs, imap, omap);
+  return areEqualComb(lhs, rhs, imap, omap, counterexample);
 }
 
 bool Checker::areEqualSeq(const GNet &lhs,
@@ -186,7 +207,8 @@ bool Checker::areEqualSeq(const GNet &lhs,
                           const GateBinding &lhsTriEncIn,
                           const GateBinding &lhsTriDecOut,
                           const GateBinding &rhsTriEncOut,
-                          const GateBinding &rhsTriDecIn) const {
+                          const GateBinding &rhsTriDecIn,
+                          Counterexample *counterexample) const {
   
   //=========================================//
   //                                         //
@@ -230,13 +252,15 @@ bool Checker::areEqualSeq(const GNet &lhs,
     imap.insert({decInLink, rhsTriLink});
   }
 
-  return areEqualCombSat({&lhs, &rhs, &enc, &dec}, &connectTo, imap, omap);
+  return areEqualCombSat({&lhs, &rhs, &enc, &dec}, &connectTo, imap, omap,
+                         counterexample);
 }
 
 bool Checker::areEqualCombSim(const GNet &lhs,
                               const GNet &rhs,
                               const GateBinding &ibind,
-                              const GateBinding &obind) const {
+                              const GateBinding &obind,
+                              Counterexample *counterexample) const {
   assert(lhs.nSourceLinks() == rhs.nSourceLinks());
   assert(lhs.nSourceLinks() <= 16);
 
@@ -267,14 +291,45 @@ bool Checker::areEqualCombSim(const GNet &lhs,
   auto lhsCompiled = simulator.compile(lhs, lhsInputs, lhsOutputs);
   auto rhsCompiled = simulator.compile(rhs, rhsInputs, rhsOutputs);
 
-  for (std::uint64_t in = 0; in < (1ull << lhs.nSourceLinks()); in++) {
-    std::uint64_t lhsOut, rhsOut;
+  using Compiled = eda::gate::simulator::Simulator::Compiled;
+
+  const auto nIn = lhs.nSourceLinks();
+  const auto nOut = lhsOutputs.size();
+
+  // Enumerate the input combinations by blocks of Compiled::WIDTH patterns.
+  const std::uint64_t nBlocks =
+      nIn > 6 ? (1ull << (nIn - 6)) : 1;
+  const Compiled::W mask =
+      nIn >= 6 ? ~0ull : ((1ull << (1ull << nIn)) - 1);
+
+  Compiled::WV in(nIn);
+  Compiled::WV lhsOut(nOut);
+  Compiled::WV rhsOut(nOut);
+
+  for (std::uint64_t block = 0; block < nBlocks; block++) {
+    for (std::size_t i = 0; i < nIn; i++) {
+      in[i] = Compiled::exhaustive(i, block);
+    }
 
     lhsCompiled.simulate(lhsOut, in);
     rhsCompiled.simulate(rhsOut, in);
 
-    if (lhsOut != rhsOut) {
-      return false;
+    for (std::size_t i = 0; i < nOut; i++) {
+      const auto diff = (lhsOut[i] ^ rhsOut[i]) & mask;
+      if (diff) {
+        // Take the first distinguishing pattern of the block.
+        const auto j = __builtin_ctzll(diff);
+
+        if (counterexample) {
+          counterexample->nInputs = nIn;
+          counterexample->inputs.clear();
+          for (std::size_t k = 0; k < nIn; k++) {
+            counterexample->inputs.push_back({lhsInputs[k].source,
+                                              ((in[k] >> j) & 1) != 0});
+          }
+        }
+        return false;
+      }
     }
   }
 
@@ -284,7 +339,8 @@ bool Checker::areEqualCombSim(const GNet &lhs,
 bool Checker::areEqualCombSat(const std::vector<const GNet*> &nets,
                               const GateConnect *connectTo,
                               const GateBinding &ibind,
-                              const GateBinding &obind) const {
+                              const GateBinding &obind,
+                              Counterexample *counterexample) const {
   Encoder encoder;
   encoder.setConnectTo(connectTo);
 
@@ -302,23 +358,25 @@ bool Checker::areEqualCombSat(const std::vector<const GNet*> &nets,
   }
 
   // Compare the outputs.
-  Context::Clause existsDiff;
+  std::vector<Encoder::VarPair> outputs;
+  outputs.reserve(obind.size());
   for (const auto &[lhsGateLink, rhsGateLink] : obind) {
-    const auto y  = encoder.newVar();
-    const auto x1 = encoder.var(lhsGateLink.source, 0);
-    const auto x2 = encoder.var(rhsGateLink.source, 0);
-
-    encoder.encodeXor(y, x1, x2, true, true, true);
-    existsDiff.push(Context::lit(y, true));
+    outputs.push_back({encoder.var(lhsGateLink.source, 0),
+                       encoder.var(rhsGateLink.source, 0)});
   }
 
   // (lOut[1] != rOut[1]) || ... || (lOut[m] != rOut[m]).
-  encoder.encode(existsDiff);
+  Context::Clause assumptions;
+  assumptions.push(encoder.encodeDiff(outputs));
 
-  const auto verdict = !encoder.solve();
+  const auto verdict = !encoder.solve(assumptions);
 
   if (!verdict) {
     error(encoder.context(), ibind, obind);
+
+    if (counterexample) {
+      *counterexample = minimizeCounterexample(encoder, ibind, obind);
+    }
   }
 
   return verdict;
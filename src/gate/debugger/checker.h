@@ -10,6 +10,7 @@
 
 #include "gate/debugger/base_checker.h"
 #include "gate/debugger/context.h"
+#include "gate/debugger/counterexample.h"
 #include "gate/debugger/encoder.h"
 #include "gate/model/gnet.h"
 #include "gate/premapper/premapper.h"
@@ -81,10 +82,14 @@ public:
     std::shared_ptr<GateBinding> innerBinding;
   };
 
-  /// Checks logic equivalence of two nets.
+  /// Checks logic equivalence of two nets. If the nets are not equal and
+  /// the counterexample is requested, it is returned (minimized if found
+  /// by SAT; it can be replayed by replayCounterexample). It is filled by
+  /// the flat combinational checks and the checks w/ known triggers.
   bool areEqual(const GNet &lhs,
                 const GNet &rhs,
-                const Hints &hints) const;
+                const Hints &hints,
+                Counterexample *counterexample = nullptr) const;
   
   bool areEqual(GNet &lhs,
                 GNet &rhs,
@@ -100,7 +105,8 @@ private:
   bool areEqualComb(const GNet &lhs,
                     const GNet &rhs,
 	            const GateBinding &ibind,
-	            const GateBinding &obind) const;
+	            const GateBinding &obind,
+                    Counterexample *counterexample) const;
 
   /// Checks logic equivalence of two flat sequential nets
   /// with one-to-one correspondence of triggers.
@@ -108,7 +114,8 @@ private:
                    const GNet &rhs,
                    const GateBinding &ibind,
                    const GateBinding &obind,
-                   const GateBinding &tbind) const;
+                   const GateBinding &tbind,
+                   Counterexample *counterexample) const;
 
   /// Checks logic equivalence of two flat sequential nets
   /// with given correspondence of state encodings.
@@ -121,20 +128,23 @@ private:
                    const GateBinding &lhsTriEncIn,
                    const GateBinding &lhsTriDecOut,
                    const GateBinding &rhsTriEncOut,
-                   const GateBinding &rhsTriDecIn) const;
+                   const GateBinding &rhsTriDecIn,
+                   Counterexample *counterexample) const;
 
   /// Simulation-based LEC of two small combinational nets by
   /// applying all possible inputs and checking the outputs.
   bool areEqualCombSim(const GNet &lhs,
                        const GNet &rhs,
                        const GateBinding &ibind,
-                       const GateBinding &obind) const;
+                       const GateBinding &obind,
+                       Counterexample *counterexample) const;
 
   /// SAT-based LEC of two flat combinational nets.
   bool areEqualCombSat(const std::vector<const GNet*> &nets,
                        const GateConnect *connectTo,
 	               const GateBinding &ibind,
-	               const GateBinding &obind) const;
+	               const GateBinding &obind,
+                       Counterexample *counterexample) const;
 
   /// Handles an error (prints the diagnostics, etc.).
   void error(Context &context,
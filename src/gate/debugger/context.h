@@ -42,9 +42,13 @@ public:
     return Minisat::mkLit(static_cast<Var>(var), sign);
   }
 
-  /// Returns a variable id.
+  /// Returns a variable id (allocates a new variable on the first call).
   uint64_t var(Gate::Id gateId, uint16_t version) {
-    return reserve(var(_connectTo, gateId, version));
+    const auto [i, isNew] = _vars.emplace(key(gateId, version), 0);
+    if (isNew) {
+      i->second = newVar();
+    }
+    return i->second;
   }
 
   /// Returns a variable id.
@@ -61,14 +65,19 @@ public:
 
   /// Returns a new variable id.
   uint64_t newVar() {
-    // See the variable id format.
-    static uint64_t var = 0;
-    return reserve(((var++) << 1) | 1);
+    return static_cast<uint64_t>(_solver.newVar());
   }
 
-  /// Returns the variable value.
+  /// Returns the variable value (false if the variable is not in the model).
   bool value(uint64_t var) {
-    return _solver.modelValue(static_cast<Var>(var)) == Minisat::l_True;
+    return var < static_cast<uint64_t>(_solver.model.size())
+        && _solver.modelValue(static_cast<Var>(var)) == Minisat::l_True;
+  }
+
+  /// Solves the formula under the assumptions. The solver state (including
+  /// the learnt clauses) is kept, so it can be queried incrementally.
+  bool solve(const Clause &assumptions) {
+    return _solver.solve(assumptions);
   }
 
   /// Dumps the current formula to the file.
@@ -88,21 +97,17 @@ public:
 
 private:
   /**
-   * Returns a variable id, which is an integer of the following format:
+   * Returns a key of the variable map, which is an integer of the format:
    *
-   * |0..0|Version|GateId|New|
-   *    2     8      20   (1)  32 bits [as is]
-   *  (16)  (16)    (31)  (1)  64 bits [to be]
+   * |0..0|Version|GateId|
+   *   16     16     32   64 bits
    *
-   * The version is used for symbolic execution and can borrow bits for id.
-   * The current limitations on the field widths are caused by MiniSAT.
+   * The version is used for symbolic execution. The SAT variables are
+   * allocated contiguously, so the solver memory is proportional to the
+   * number of the encoded gates (not to the maximum gate id).
    */
-  static uint64_t var(const GateConnect *connectTo,
-                      Gate::Id gateId,
-                      uint16_t version) {
-    // FIXME: Such encoding is not suitable for MiniSAT w/ IntMap implemented as a vector.
-    return ((uint64_t)version << 21) |
-           ((uint64_t)connectedTo(connectTo, gateId) << 1);
+  uint64_t key(Gate::Id gateId, uint16_t version) const {
+    return ((uint64_t)version << 32) | connectedTo(_connectTo, gateId);
   }
 
   /// Returns the gate id the given one is connected to.
@@ -116,15 +121,9 @@ private:
     return gateId;
   }
 
-  /// Allocates the variable in the SAT solver.
-  uint64_t reserve(uint64_t var) {
-    while (var >= (uint64_t)_solver.nVars()) {
-      _solver.newVar();
-    }
-    return var;
-  }
-
   const GateConnect *_connectTo = nullptr;
+  /// Maps (gate, version) keys to the SAT variables.
+  std::unordered_map<uint64_t, uint64_t> _vars;
   Solver _solver;
 };
 
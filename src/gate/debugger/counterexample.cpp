@@ -0,0 +1,201 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/counterexample.h"
+#include "gate/simulator/simulator.h"
+
+#include <cassert>
+#include <unordered_set>
+
+namespace eda::gate::debugger {
+
+using Gate = model::Gate;
+using GNet = model::GNet;
+using Simulator = simulator::Simulator;
+
+Counterexample minimizeCounterexample(Encoder &encoder,
+                                      const CexBinding &ibind,
+                                      const CexBinding &obind) {
+  auto &context = encoder.context();
+
+  // Take the input values from the model (the variable is the negation).
+  Counterexample cex;
+  cex.nInputs = ibind.size();
+  cex.inputs.reserve(ibind.size());
+
+  std::vector<Context::Lit> lits;
+  lits.reserve(ibind.size());
+
+  for (const auto &[lhsGateLink, rhsGateLink] : ibind) {
+    const auto x = encoder.var(lhsGateLink.source, 0);
+    const auto value = !context.value(x);
+
+    cex.inputs.push_back({lhsGateLink.source, value});
+    lits.push_back(Context::lit(x, value));
+  }
+
+  std::vector<Encoder::VarPair> outputs;
+  outputs.reserve(obind.size());
+  for (const auto &[lhsGateLink, rhsGateLink] : obind) {
+    outputs.push_back({encoder.var(lhsGateLink.source, 0),
+                       encoder.var(rhsGateLink.source, 0)});
+  }
+
+  const auto same = encoder.encodeSame(outputs);
+
+  // Checks whether the selected inputs force the outputs to differ.
+  const auto isForced = [&](const std::vector<bool> &selected) {
+    Context::Clause assumptions;
+    assumptions.push(same);
+    for (std::size_t i = 0; i < lits.size(); i++) {
+      if (selected[i]) {
+        assumptions.push(lits[i]);
+      }
+    }
+    return !encoder.solve(assumptions);
+  };
+
+  std::vector<bool> selected(lits.size(), true);
+  if (!isForced(selected)) {
+    // Should not happen for combinational nets: keep the full assignment.
+    encoder.release(same);
+    return cex;
+  }
+
+  // Initial set of the relevant inputs: the unsatisfiable core.
+  auto &conflict = context.solver().conflict;
+  for (std::size_t i = 0; i < lits.size(); i++) {
+    selected[i] = conflict.has(~lits[i]);
+  }
+
+  // Drop the inputs whose values do not matter.
+  for (std::size_t i = 0; i < lits.size(); i++) {
+    if (!selected[i]) continue;
+
+    selected[i] = false;
+    if (!isForced(selected)) {
+      selected[i] = true;
+    }
+  }
+
+  encoder.release(same);
+
+  Counterexample::Assignment inputs;
+  for (std::size_t i = 0; i < lits.size(); i++) {
+    if (selected[i]) {
+      inputs.push_back(cex.inputs[i]);
+    }
+  }
+  cex.inputs = std::move(inputs);
+
+  return cex;
+}
+
+/// Simulates the net and returns the values of all its gates.
+static std::unordered_map<Gate::Id, bool> simulate(
+    const GNet &net,
+    const GNet::LinkList &inputs,
+    const Simulator::Compiled::BV &values) {
+  GNet::LinkList gates;
+  gates.reserve(net.nGates());
+  for (const auto *gate : net.gates()) {
+    gates.push_back(Gate::Link(gate->id()));
+  }
+
+  Simulator simulator;
+  auto compiled = simulator.compile(net, inputs, gates);
+
+  Simulator::Compiled::BV result(gates.size());
+  compiled.simulate(result, values);
+
+  std::unordered_map<Gate::Id, bool> gateValues;
+  gateValues.reserve(gates.size());
+  for (std::size_t i = 0; i < gates.size(); i++) {
+    gateValues[gates[i].source] = result[i];
+  }
+
+  return gateValues;
+}
+
+/// Dumps the gate values of the fanin cone of the given gate.
+static void dumpCone(const GNet &net,
+                     Gate::Id gateId,
+                     const std::unordered_map<Gate::Id, bool> &values,
+                     std::ostream &out) {
+  std::unordered_set<Gate::Id> cone;
+  std::vector<Gate::Id> stack{gateId};
+
+  while (!stack.empty()) {
+    const auto id = stack.back();
+    stack.pop_back();
+
+    if (!cone.insert(id).second) continue;
+
+    for (const auto &input : Gate::get(id)->inputs()) {
+      stack.push_back(input.node());
+    }
+  }
+
+  // The net is sorted, so the gates are dumped in topological order.
+  for (const auto *gate : net.gates()) {
+    if (cone.find(gate->id()) != cone.end()) {
+      out << "  " << *gate << " = " << values.at(gate->id()) << std::endl;
+    }
+  }
+}
+
+bool replayCounterexample(const GNet &lhs,
+                          const GNet &rhs,
+                          const CexBinding &ibind,
+                          const CexBinding &obind,
+                          const Counterexample &cex,
+                          std::ostream &out) {
+  assert(lhs.isComb() && rhs.isComb());
+
+  std::unordered_map<Gate::Id, bool> assignment(cex.inputs.begin(),
+                                                cex.inputs.end());
+
+  GNet::LinkList lhsInputs, rhsInputs;
+  Simulator::Compiled::BV values;
+
+  lhsInputs.reserve(ibind.size());
+  rhsInputs.reserve(ibind.size());
+  values.reserve(ibind.size());
+
+  for (const auto &[lhsGateLink, rhsGateLink] : ibind) {
+    lhsInputs.push_back(lhsGateLink);
+    rhsInputs.push_back(rhsGateLink);
+
+    const auto i = assignment.find(lhsGateLink.source);
+    values.push_back(i != assignment.end() && i->second);
+  }
+
+  const auto lhsValues = simulate(lhs, lhsInputs, values);
+  const auto rhsValues = simulate(rhs, rhsInputs, values);
+
+  for (const auto &[lhsGateLink, rhsGateLink] : obind) {
+    const auto lhsValue = lhsValues.at(lhsGateLink.source);
+    const auto rhsValue = rhsValues.at(rhsGateLink.source);
+
+    if (lhsValue != rhsValue) {
+      out << "Outputs diverge: " << lhsGateLink.source << "=" << lhsValue
+          << ", " << rhsGateLink.source << "=" << rhsValue << std::endl;
+
+      out << "LHS cone:" << std::endl;
+      dumpCone(lhs, lhsGateLink.source, lhsValues, out);
+      out << "RHS cone:" << std::endl;
+      dumpCone(rhs, rhsGateLink.source, rhsValues, out);
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace eda::gate::debugger
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "gate/debugger/encoder.h"
+#include "gate/model/gnet.h"
+
+#include <cstddef>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace eda::gate::debugger {
+
+/**
+ * \brief Failure artifact of an LEC: the inputs distinguishing the nets.
+ */
+struct Counterexample final {
+  using Gate = eda::gate::model::Gate;
+  using Assignment = std::vector<std::pair<Gate::Id, bool>>;
+
+  /// Values of the LHS inputs (the omitted inputs are don't-cares).
+  Assignment inputs;
+  /// Number of the inputs before minimization.
+  std::size_t nInputs = 0;
+
+  bool empty() const { return nInputs == 0; }
+};
+
+using CexBinding = std::unordered_map<model::Gate::Link, model::Gate::Link>;
+
+/**
+ * \brief Extracts the counterexample from the model of the last (satisfiable)
+ * query and minimizes it.
+ *
+ * The input values are passed to the incremental solver as assumptions
+ * together w/ the output equality, and the unsatisfiable core gives the
+ * initial set of the relevant inputs. Then, each input is dropped (i.e.,
+ * both its values are tried) if the outputs still differ.
+ */
+Counterexample minimizeCounterexample(Encoder &encoder,
+                                      const CexBinding &ibind,
+                                      const CexBinding &obind);
+
+/**
+ * \brief Re-simulates two combinational nets on the counterexample.
+ *
+ * The don't-care inputs are set to zero. For the first diverging output
+ * pair, the values of the gates of its fanin cones are dumped. The nets
+ * should be topologically sorted.
+ *
+ * @return true if the outputs diverge.
+ */
+bool replayCounterexample(const model::GNet &lhs,
+                          const model::GNet &rhs,
+                          const CexBinding &ibind,
+                          const CexBinding &obind,
+                          const Counterexample &cex,
+                          std::ostream &out = std::cout);
+
+} // namespace eda::gate::debugger
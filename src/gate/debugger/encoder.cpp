@@ -21,6 +21,10 @@ void Encoder::encode(const GNet &net, uint16_t version) {
 void Encoder::encode(const Gate &gate, uint16_t version) {
   using GateSymbol = eda::gate::model::GateSymbol;
 
+  if (!_encoded.insert(key(gate.id(), version)).second) {
+    return;
+  }
+
   switch (gate.func()) {
   case GateSymbol::IN:
     break;
@@ -75,6 +79,56 @@ void Encoder::encode(const Gate &gate, uint16_t version) {
   }
 }
 
+void Encoder::encodeCone(const Gate &gate, uint16_t version) {
+  // The flag indicates whether the gate inputs have been pushed.
+  std::vector<std::pair<const Gate*, bool>> stack;
+  stack.push_back({&gate, false});
+
+  while (!stack.empty()) {
+    const auto [current, expanded] = stack.back();
+
+    if (isEncoded(current->id(), version)) {
+      stack.pop_back();
+    } else if (expanded || current->isSource() || current->isTrigger()) {
+      encode(*current, version);
+      stack.pop_back();
+    } else {
+      stack.back().second = true;
+      for (const auto &input : current->inputs()) {
+        if (!isEncoded(input.node(), version)) {
+          stack.push_back({Gate::get(input.node()), false});
+        }
+      }
+    }
+  }
+}
+
+Context::Lit Encoder::encodeDiff(const std::vector<VarPair> &pairs) {
+  const auto act = _context.newVar();
+
+  Context::Clause clause;
+  clause.push(Context::lit(act, true));
+  for (const auto &[x1, x2] : pairs) {
+    const auto y = _context.newVar();
+    encodeXor(y, x1, x2, true, true, true);
+    clause.push(Context::lit(y, true));
+  }
+  encode(clause);
+
+  return Context::lit(act, false);
+}
+
+Context::Lit Encoder::encodeSame(const std::vector<VarPair> &pairs) {
+  const auto act = _context.newVar();
+
+  for (const auto &[x1, x2] : pairs) {
+    encode(Context::lit(act, true), Context::lit(x1, true), Context::lit(x2, false));
+    encode(Context::lit(act, true), Context::lit(x1, false), Context::lit(x2, true));
+  }
+
+  return Context::lit(act, false);
+}
+
 void Encoder::encodeFix(const Gate &gate, bool sign, uint16_t version) {
   const auto y = _context.var(gate, version, Context::SET);
 
@@ -130,7 +184,8 @@ void Encoder::encodeXor(const Gate &gate, bool sign, uint16_t version) {
       ? _context.var(gate.input(i + 1), version, Context::GET)
       : _context.newVar();
 
-    encodeXor(y, x1, x2, sign, true, true);
+    // The sign is applied once (to the gate output).
+    encodeXor(y, x1, x2, i == 0 ? sign : true, true, true);
     y = x2;
   }
 }
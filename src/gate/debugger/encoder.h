@@ -14,12 +14,20 @@
 #include "minisat/core/Solver.h"
 
 #include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace eda::gate::debugger {
 
 /**
  * \brief Implements a Tseitin encoder of a gate-level netlist.
+ *
+ * The encoder is incremental: every gate (version) is encoded once, so
+ * the cones shared by several queries are reused. The query-specific
+ * clauses are guarded by activation literals passed to the solver as
+ * assumptions; the learnt clauses are kept between the queries.
+ *
  * \author <a href="mailto:kamkin@ispras.ru">Alexander Kamkin</a>
  */
 class Encoder final {
@@ -27,9 +35,35 @@ class Encoder final {
   using GNet = eda::gate::model::GNet;
 
 public:
+  /// Pair of variables to be compared.
+  using VarPair = std::pair<uint64_t, uint64_t>;
+
   void encode(const GNet &net, uint16_t version);
+  /// Encodes the gate (does nothing if the gate has been already encoded).
   void encode(const Gate &gate, uint16_t version);
 
+  /// Encodes the transitive fanin cone of the gate cut at the triggers
+  /// (the already encoded gates are reused).
+  void encodeCone(const Gate &gate, uint16_t version);
+
+  /// Checks whether the gate has been encoded.
+  bool isEncoded(Gate::Id gateId, uint16_t version) const {
+    return _encoded.find(key(gateId, version)) != _encoded.end();
+  }
+
+  /// Encodes act -> (x1[1] != x2[1]) | ... | (x1[m] != x2[m]) and returns
+  /// the activation literal act (to be passed to solve as an assumption).
+  Context::Lit encodeDiff(const std::vector<VarPair> &pairs);
+
+  /// Encodes act -> (x1[1] == x2[1]) & ... & (x1[m] == x2[m]) and returns
+  /// the activation literal act (to be passed to solve as an assumption).
+  Context::Lit encodeSame(const std::vector<VarPair> &pairs);
+
+  /// Permanently disables the clauses guarded by the activation literal.
+  void release(Context::Lit act) {
+    encode(~act);
+  }
+
   // Combinational gates.
   void encodeFix(const Gate &gate, bool sign, uint16_t version);
   void encodeBuf(const Gate &gate, bool sign, uint16_t version);
@@ -95,8 +129,17 @@ public:
     return _context.solver().solve();
   }
 
+  bool solve(const Context::Clause &assumptions) {
+    return _context.solve(assumptions);
+  }
+
 private:
+  static uint64_t key(Gate::Id gateId, uint16_t version) {
+    return ((uint64_t)version << 32) | gateId;
+  }
+
   Context _context;
+  std::unordered_set<uint64_t> _encoded;
 };
 
 } // namespace eda::gate::debugger
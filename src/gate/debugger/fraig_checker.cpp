@@ -0,0 +1,335 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/encoder.h"
+#include "gate/debugger/fraig_checker.h"
+#include "gate/debugger/miter.h"
+#include "gate/model/garray.h"
+#include "gate/optimizer/ttbuilder.h"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace eda::gate::debugger {
+
+using GArray = model::GArray;
+using Index = GArray::Index;
+using Lit = Context::Lit;
+using TTBuilder = optimizer::TTBuilder;
+
+namespace {
+
+/// Simulation signature of a gate.
+using Signature = std::vector<uint64_t>;
+
+struct SignatureHash final {
+  std::size_t operator()(const Signature &signature) const {
+    std::size_t hash = 0;
+    for (const auto word : signature) {
+      hash ^= word + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+  }
+};
+
+/**
+ * \brief SAT sweeping of a combinational miter.
+ */
+class Sweeper final {
+public:
+  using Stats = FraigChecker::Stats;
+
+  Sweeper(const GNet &miter,
+          std::size_t simWords,
+          int conflictLimit,
+          std::size_t maxCandidates,
+          Stats &stats):
+      array(miter),
+      conflictLimit(conflictLimit),
+      maxCandidates(maxCandidates),
+      stats(stats),
+      sims(array.nGates()),
+      merged(array.nGates(), false),
+      cex(array.nGates(), 0) {
+    encoder.setConnectTo(&connectTo);
+
+    std::mt19937_64 gen(0);
+    for (std::size_t i = 0; i < simWords; i++) {
+      simulate([&gen](Index) { return gen(); });
+    }
+  }
+
+  /// Sweeps the gates and checks whether the outputs are always 0.
+  bool run() {
+    for (Index i = 0; i < array.nGates(); i++) {
+      encoder.encode(*model::Gate::get(array.id(i)), 0);
+
+      if (!array.isTarget(i)) {
+        sweep(i);
+      }
+    }
+
+    // The final check is done w/o the conflict limit.
+    for (Index i = 0; i < array.nGates(); i++) {
+      if (array.isTarget(i) && solve(lit(i, false), false) != Minisat::l_False) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  /// Number of the counterexamples simulated at once.
+  static constexpr std::size_t MAX_CEX = 64;
+
+  using Classes = std::unordered_map<Signature,
+                                     std::vector<Index>,
+                                     SignatureHash>;
+
+  /// Returns the literal x[i]^sign (the encoder assigns the variables
+  /// the inverted gate values: true stands for 0).
+  Lit lit(Index i, bool sign) {
+    return Context::lit(encoder.var(array.id(i), 0), !sign);
+  }
+
+  /// Returns the normalized signature (the first bit is 0) and the phase.
+  Signature signature(Index i, bool &phase) const {
+    Signature result = sims[i];
+    phase = result.front() & 1;
+    if (phase) {
+      for (auto &word : result) {
+        word = ~word;
+      }
+    }
+    return result;
+  }
+
+  /// Simulates a new word (the source values are given by the function).
+  template <typename Sources>
+  void simulate(Sources sources) {
+    TTBuilder::TruthTableList inputs;
+    for (Index i = 0; i < array.nGates(); i++) {
+      uint64_t word;
+      if (array.isSource(i)) {
+        word = sources(i);
+      } else {
+        inputs.resize(array.arity(i));
+        for (std::size_t j = 0; j < inputs.size(); j++) {
+          inputs[j] = sims[array.fanin(i, j)].back();
+        }
+        word = TTBuilder::applyGateFunc(array.func(i), inputs);
+      }
+      sims[i].push_back(word);
+    }
+  }
+
+  /// Simulates the collected counterexamples and rebuilds the classes
+  /// of the representatives preceding the given gate.
+  void refine(Index n) {
+    simulate([this](Index i) { return cex[i]; });
+    std::fill(cex.begin(), cex.end(), 0);
+    nCex = 0;
+
+    classes.clear();
+    for (Index i = 0; i < n; i++) {
+      if (!merged[i] && !array.isTarget(i)) {
+        bool phase;
+        classes[signature(i, phase)].push_back(i);
+      }
+    }
+
+    stats.nRefinements++;
+  }
+
+  /// Solves the formula under the assumption.
+  Minisat::lbool solve(Lit assumption, bool limited) {
+    Minisat::vec<Lit> assumptions;
+    assumptions.push(assumption);
+
+    auto &solver = encoder.context().solver();
+    if (limited) {
+      solver.setConfBudget(conflictLimit);
+    } else {
+      solver.budgetOff();
+    }
+
+    return solver.solveLimited(assumptions);
+  }
+
+  /// Checks whether x[i]^s == x[j]^t (j is not given for the constant 0).
+  Minisat::lbool prove(Index i, bool s, const Index *j, bool t) {
+    stats.nCalls++;
+
+    Lit diff;
+    if (j) {
+      diff = Context::lit(encoder.newVar(), false);
+      encoder.encode(~diff, lit(i, s), lit(*j, t));
+      encoder.encode(~diff, lit(i, !s), lit(*j, !t));
+    } else {
+      diff = lit(i, s);
+    }
+
+    const auto result = solve(diff, true);
+
+    if (result == Minisat::l_True) {
+      // Save the counterexample.
+      auto &context = encoder.context();
+      for (Index k = 0; k < array.nGates(); k++) {
+        if (array.isSource(k) && !context.value(encoder.var(array.id(k), 0))) {
+          cex[k] |= 1ull << nCex;
+        }
+      }
+      nCex++;
+      stats.nRefuted++;
+    } else if (result == Minisat::l_False) {
+      stats.nProved++;
+    } else {
+      stats.nUndecided++;
+    }
+
+    if (j) {
+      encoder.encode(~diff);
+    }
+
+    return result;
+  }
+
+  /// Merges the gate w/ the candidate or makes it a representative.
+  void sweep(Index i) {
+    bool s;
+    auto key = signature(i, s);
+
+    // Constant candidate.
+    if (std::all_of(key.begin(), key.end(), [](uint64_t w) { return !w; })) {
+      const auto result = prove(i, s, nullptr, false);
+      if (result == Minisat::l_False) {
+        encoder.encodeFix(encoder.var(array.id(i), 0), s);
+        merged[i] = true;
+        return;
+      }
+      if (nCex == MAX_CEX) {
+        refine(i);
+        key = signature(i, s);
+      }
+    }
+
+    std::size_t nChecked = 0;
+    for (bool done = false; !done && nChecked < maxCandidates;) {
+      done = true;
+
+      const auto found = classes.find(key);
+      if (found == classes.end()) {
+        break;
+      }
+
+      for (const auto j : found->second) {
+        if (nChecked++ == maxCandidates) {
+          break;
+        }
+
+        bool t;
+        signature(j, t);
+
+        const auto result = prove(i, s, &j, t);
+        if (result == Minisat::l_False) {
+          merge(i, j, s == t);
+          return;
+        }
+
+        if (nCex == MAX_CEX) {
+          // The classes are rebuilt: start over.
+          refine(i);
+          key = signature(i, s);
+          done = false;
+          break;
+        }
+      }
+    }
+
+    classes[key].push_back(i);
+  }
+
+  /// Merges the i-th gate w/ the representative j-th gate.
+  void merge(Index i, Index j, bool samePhase) {
+    const auto x = encoder.var(array.id(i), 0);
+    const auto y = encoder.var(array.id(j), 0);
+
+    encoder.encodeBuf(x, y, samePhase);
+    if (samePhase) {
+      // The fanouts are encoded w/ the representative.
+      connectTo[array.id(i)] = array.id(j);
+    }
+    merged[i] = true;
+  }
+
+  const GArray array;
+  const int conflictLimit;
+  const std::size_t maxCandidates;
+  Stats &stats;
+
+  Encoder encoder;
+  Context::GateConnect connectTo;
+
+  /// Simulation words of the gates.
+  std::vector<Signature> sims;
+  /// Merged gates.
+  std::vector<bool> merged;
+  /// Candidate classes (the representatives w/ the same signature).
+  Classes classes;
+
+  /// Collected counterexamples (the source values).
+  std::vector<uint64_t> cex;
+  std::size_t nCex = 0;
+};
+
+} // namespace
+
+bool FraigChecker::areEqual(GNet &lhs,
+                            GNet &rhs,
+                            GateIdMap &gmap) {
+  if (!lhs.isComb() || !rhs.isComb()) {
+    return Checker::get().areEqual(lhs, rhs, gmap);
+  }
+
+  GateBinding ibind, obind, tbind;
+
+  // Input-to-input correspondence.
+  for (auto oldSourceLink : lhs.sourceLinks()) {
+    auto newSourceId = gmap[oldSourceLink.target];
+    ibind.insert({oldSourceLink, Gate::Link(newSourceId)});
+  }
+
+  // Output-to-output correspondence.
+  for (auto oldTargetLink : lhs.targetLinks()) {
+    auto newTargetId = gmap[oldTargetLink.source];
+    obind.insert({oldTargetLink, Gate::Link(newTargetId)});
+  }
+
+  Checker::Hints hints;
+  hints.sourceBinding  = std::make_shared<GateBinding>(std::move(ibind));
+  hints.targetBinding  = std::make_shared<GateBinding>(std::move(obind));
+  hints.triggerBinding = std::make_shared<GateBinding>(std::move(tbind));
+
+  std::unique_ptr<GNet> net(miter(lhs, rhs, hints));
+  return net && isZero(*net);
+}
+
+bool FraigChecker::isZero(const GNet &miter) {
+  assert(miter.isComb() && miter.isSorted());
+
+  stats = Stats();
+
+  Sweeper sweeper(miter, simWords, conflictLimit, maxCandidates, stats);
+  return sweeper.run();
+}
+
+} // namespace eda::gate::debugger
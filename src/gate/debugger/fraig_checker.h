@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "gate/debugger/base_checker.h"
+#include "gate/debugger/checker.h"
+#include "gate/model/gnet.h"
+#include "util/singleton.h"
+
+#include <cstddef>
+
+namespace eda::gate::debugger {
+
+/**
+ * \brief Implements a SAT-sweeping (fraiging) LEC of combinational nets.
+ *
+ * The miter gates are grouped into the candidate equivalence classes by
+ * bit-parallel random simulation. The candidates are proved or refuted
+ * bottom-up by small incremental SAT calls; the proved gates are merged
+ * with their representatives, so that the subsequent calls deal with
+ * the reduced miter. The counterexamples are collected and simulated to
+ * refine the classes. Finally, the miter output is checked.
+ */
+class FraigChecker : public BaseChecker, public util::Singleton<FraigChecker> {
+  friend class util::Singleton<FraigChecker>;
+
+public:
+  using GateIdMap = Checker::GateIdMap;
+
+  /// Sweeping statistics.
+  struct Stats final {
+    /// Number of the SAT calls for the candidate pairs.
+    std::size_t nCalls = 0;
+    /// Number of the proved (merged) pairs.
+    std::size_t nProved = 0;
+    /// Number of the refuted pairs.
+    std::size_t nRefuted = 0;
+    /// Number of the pairs exceeded the conflict limit.
+    std::size_t nUndecided = 0;
+    /// Number of the class refinements.
+    std::size_t nRefinements = 0;
+  };
+
+  bool areEqual(GNet &lhs,
+                GNet &rhs,
+                GateIdMap &gmap) override;
+
+  /// Checks whether the outputs of the combinational miter are always 0.
+  bool isZero(const GNet &miter);
+
+  /// Sets the number of the 64-bit random simulation words.
+  void setSimWords(std::size_t simWords) { this->simWords = simWords; }
+
+  /// Sets the conflict limit of the candidate pair checks.
+  void setConflictLimit(int conflictLimit) {
+    this->conflictLimit = conflictLimit;
+  }
+
+  /// Sets the maximum number of the candidates checked for a gate.
+  void setMaxCandidates(std::size_t maxCandidates) {
+    this->maxCandidates = maxCandidates;
+  }
+
+  /// Returns the statistics of the last check.
+  const Stats &getStats() const { return stats; }
+
+private:
+  FraigChecker() {}
+
+  std::size_t simWords = 4;
+  int conflictLimit = 1000;
+  std::size_t maxCandidates = 4;
+
+  Stats stats;
+};
+
+} // namespace eda::gate::debugger
@@ -8,8 +8,230 @@
 
 #include "gate/debugger/miter.h"
 
+#include <cassert>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace eda::gate::debugger {
 
+namespace {
+
+/**
+ * \brief Builds a structurally hashed AIG w/ constant propagation.
+ *
+ * A node is referred to by a literal, i.e. the gate id w/ the negation
+ * flag. The inverters and the constants are created on demand.
+ */
+class AigBuilder final {
+public:
+  using Lit = uint64_t;
+
+  static constexpr GateId CONST_ID = std::numeric_limits<GateId>::max();
+  static constexpr Lit ZERO = (Lit)CONST_ID << 1;
+  static constexpr Lit ONE = ZERO | 1;
+
+  static Lit lit(GateId gateId) { return (Lit)gateId << 1; }
+
+  explicit AigBuilder(GNet &net): net(net) {}
+
+  /// Checks whether the net can be translated into the AIG.
+  static bool isSupported(const GNet &net) {
+    if (!net.isComb()) {
+      return false;
+    }
+    for (const auto *gate : net.gates()) {
+      switch (gate->func()) {
+      case GateSymbol::IN:
+      case GateSymbol::OUT:
+      case GateSymbol::ZERO:
+      case GateSymbol::ONE:
+      case GateSymbol::NOP:
+      case GateSymbol::NOT:
+      case GateSymbol::AND:
+      case GateSymbol::OR:
+      case GateSymbol::XOR:
+      case GateSymbol::NAND:
+      case GateSymbol::NOR:
+      case GateSymbol::XNOR:
+        break;
+      case GateSymbol::MAJ:
+        if (gate->arity() != 3) {
+          return false;
+        }
+        break;
+      default:
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Binds the original gate to the given literal.
+  void bind(GateId gateId, Lit lit) { lits[gateId] = lit; }
+
+  /// Translates the transitive fanin cone of the gate (the gates are
+  /// visited iteratively in depth-first order).
+  Lit translate(GateId gateId) {
+    std::vector<std::pair<GateId, bool>> stack;
+    stack.push_back({gateId, false});
+
+    while (!stack.empty()) {
+      const auto [id, expanded] = stack.back();
+      stack.pop_back();
+
+      if (lits.find(id) != lits.end()) {
+        continue;
+      }
+
+      const auto *gate = Gate::get(id);
+      if (expanded) {
+        lits[id] = translateGate(*gate);
+        continue;
+      }
+
+      stack.push_back({id, true});
+      for (const auto &input : gate->inputs()) {
+        if (lits.find(input.node()) == lits.end()) {
+          stack.push_back({input.node(), false});
+        }
+      }
+    }
+
+    return lits[gateId];
+  }
+
+  Lit addAnd(Lit lhs, Lit rhs) {
+    if (lhs > rhs) {
+      std::swap(lhs, rhs);
+    }
+
+    // Constant propagation and trivial simplifications.
+    if (lhs == ZERO || rhs == ZERO || lhs == (rhs ^ 1)) {
+      return ZERO;
+    }
+    if (lhs == ONE || lhs == rhs) {
+      return rhs;
+    }
+    if (rhs == ONE) {
+      return lhs;
+    }
+
+    const auto i = ands.find({lhs, rhs});
+    if (i != ands.end()) {
+      return i->second;
+    }
+
+    const auto result = lit(net.addAnd(gate(lhs), gate(rhs)));
+    ands.insert({{lhs, rhs}, result});
+    return result;
+  }
+
+  Lit addOr(Lit lhs, Lit rhs) {
+    return addAnd(lhs ^ 1, rhs ^ 1) ^ 1;
+  }
+
+  Lit addXor(Lit lhs, Lit rhs) {
+    return addOr(addAnd(lhs, rhs ^ 1), addAnd(lhs ^ 1, rhs));
+  }
+
+  /// Returns the gate implementing the literal.
+  GateId gate(Lit lit) {
+    if (lit == ZERO || lit == ONE) {
+      auto &constId = (lit == ZERO) ? zeroId : oneId;
+      if (constId == CONST_ID) {
+        constId = net.addGate(lit == ZERO ? GateSymbol::ZERO : GateSymbol::ONE);
+      }
+      return constId;
+    }
+
+    const auto gateId = static_cast<GateId>(lit >> 1);
+    if (!(lit & 1)) {
+      return gateId;
+    }
+
+    const auto i = nots.find(gateId);
+    if (i != nots.end()) {
+      return i->second;
+    }
+
+    const auto notId = net.addNot(gateId);
+    nots.insert({gateId, notId});
+    return notId;
+  }
+
+private:
+  struct PairHash final {
+    std::size_t operator()(const std::pair<Lit, Lit> &pair) const {
+      return std::hash<Lit>()(pair.first * 0x9e3779b97f4a7c15ull ^ pair.second);
+    }
+  };
+
+  Lit translateGate(const Gate &gate) {
+    std::vector<Lit> inputs;
+    inputs.reserve(gate.arity());
+    for (const auto &input : gate.inputs()) {
+      inputs.push_back(lits[input.node()]);
+    }
+
+    Lit result;
+    switch (gate.func()) {
+    case GateSymbol::IN:
+      // The unbound input is a free variable.
+      return lit(net.addIn());
+    case GateSymbol::ZERO:
+      return ZERO;
+    case GateSymbol::ONE:
+      return ONE;
+    case GateSymbol::OUT:
+    case GateSymbol::NOP:
+      return inputs[0];
+    case GateSymbol::NOT:
+      return inputs[0] ^ 1;
+    case GateSymbol::AND:
+    case GateSymbol::NAND:
+      result = ONE;
+      for (const auto input : inputs) {
+        result = addAnd(result, input);
+      }
+      return gate.func() == GateSymbol::AND ? result : result ^ 1;
+    case GateSymbol::OR:
+    case GateSymbol::NOR:
+      result = ZERO;
+      for (const auto input : inputs) {
+        result = addOr(result, input);
+      }
+      return gate.func() == GateSymbol::OR ? result : result ^ 1;
+    case GateSymbol::XOR:
+    case GateSymbol::XNOR:
+      result = ZERO;
+      for (const auto input : inputs) {
+        result = addXor(result, input);
+      }
+      return gate.func() == GateSymbol::XOR ? result : result ^ 1;
+    case GateSymbol::MAJ:
+      return addOr(addOr(addAnd(inputs[0], inputs[1]),
+                         addAnd(inputs[0], inputs[2])),
+                   addAnd(inputs[1], inputs[2]));
+    default:
+      assert(false && "Unsupported gate");
+      return ZERO;
+    }
+  }
+
+  GNet &net;
+
+  std::unordered_map<GateId, Lit> lits;
+  std::unordered_map<std::pair<Lit, Lit>, Lit, PairHash> ands;
+  std::unordered_map<GateId, GateId> nots;
+
+  GateId zeroId = CONST_ID;
+  GateId oneId = CONST_ID;
+};
+
+} // namespace
+
 bool areMiterable(GNet &net1, GNet &net2, Hints &hints) {
   if (net1.nSourceLinks() != net2.nSourceLinks()) {
     CHECK(false) << "Nets do not have the same number of inputs\n";
@@ -32,11 +254,53 @@ bool areMiterable(GNet &net1, GNet &net2, Hints &hints) {
   return true;
 }
 
-GNet *miter(GNet &net1, GNet &net2, Hints &hints) {
-  if (not areMiterable(net1, net2, hints)) {
-    return nullptr;
+/// Builds the miter of the combinational nets as a shared AIG.
+static GNet *strashMiter(GNet &net1, GNet &net2, Hints &hints,
+                         MiterStats &stats) {
+  GNet *miter = new GNet();
+  AigBuilder builder(*miter);
+
+  // Input-to-input correspondence.
+  for (auto bind : *hints.sourceBinding.get()) {
+    const auto input = AigBuilder::lit(miter->addIn());
+    builder.bind(bind.first.target, input);
+    builder.bind(bind.second.target, input);
+  }
+
+  // Output-to-output correspondence.
+  SignalList xorSignalList;
+  for (auto bind : *hints.targetBinding.get()) {
+    const auto lhs = builder.translate(bind.first.source);
+    const auto rhs = builder.translate(bind.second.source);
+
+    stats.nOutputs++;
+    if (lhs == rhs) {
+      stats.nDischarged++;
+      continue;
+    }
+
+    const auto diff = builder.addXor(lhs, rhs);
+    xorSignalList.push_back(Signal::always(builder.gate(diff)));
   }
 
+  GateId finalOutId;
+  if (xorSignalList.empty()) {
+    finalOutId = builder.gate(AigBuilder::ZERO);
+  } else if (xorSignalList.size() == 1) {
+    finalOutId = xorSignalList.front().node();
+  } else {
+    finalOutId = miter->addOr(xorSignalList);
+  }
+  miter->addOut(finalOutId);
+
+  miter->sortTopologically();
+  return miter;
+}
+
+/// Builds the miter by gluing the nets together.
+static GNet *glueMiter(GNet &net1, GNet &net2, Hints &hints,
+                       MiterStats &stats) {
+
   std::unordered_map<Gate::Id, Gate::Id> map1 = {};
   std::unordered_map<Gate::Id, Gate::Id> map2 = {};
   GNet *cloned1 = net1.clone(map1);
@@ -100,6 +364,29 @@ GNet *miter(GNet &net1, GNet &net2, Hints &hints) {
   }
 
   miter->sortTopologically();
+
+  stats.nOutputs = newHints.targetBinding->size();
   return miter;
 }
+
+GNet *miter(GNet &net1, GNet &net2, Hints &hints, MiterStats *stats) {
+  if (not areMiterable(net1, net2, hints)) {
+    return nullptr;
+  }
+
+  MiterStats miterStats;
+  miterStats.nNetGates = net1.nGates() + net2.nGates();
+
+  GNet *miter = AigBuilder::isSupported(net1) && AigBuilder::isSupported(net2)
+      ? strashMiter(net1, net2, hints, miterStats)
+      : glueMiter(net1, net2, hints, miterStats);
+
+  miterStats.nMiterGates = miter->nGates();
+  if (stats) {
+    *stats = miterStats;
+  }
+
+  return miter;
+}
+
 } // namespace eda::gate::debugger
@@ -11,6 +11,8 @@
 #include "gate/debugger/checker.h"
 #include "util/logging.h"
 
+#include <cstddef>
+
 namespace eda::gate::debugger {
 
 using Gate = model::Gate;
@@ -23,12 +25,32 @@ using Hints = eda::gate::debugger::Checker::Hints;
 using Signal = model::Gate::Signal;
 using SignalList = model::Gate::SignalList;
 
+/// Statistics of the miter construction.
+struct MiterStats final {
+  /// Number of the output pairs.
+  std::size_t nOutputs = 0;
+  /// Number of the output pairs w/ the same driver after hashing.
+  std::size_t nDischarged = 0;
+  /// Total number of the gates in the original nets.
+  std::size_t nNetGates = 0;
+  /// Number of the gates in the miter.
+  std::size_t nMiterGates = 0;
+};
+
 /**
  *  \brief Constructs a miter for the specified nets.
+ *
+ *  Combinational nets are structurally hashed into one shared AIG w/
+ *  constant propagation, so the logic common to both nets is represented
+ *  once, and the output pairs driven by the same node are excluded from
+ *  the miter (if all of them are, the miter output is constant zero).
+ *  Sequential nets are glued together as they are.
+ *
  *  @param hints Gate-to-gate mapping between nets.
+ *  @param stats Statistics to be filled (optional).
  *  @return The miter.
  */
-GNet *miter(GNet &net1, GNet &net2, Hints &hints);
+GNet *miter(GNet &net1, GNet &net2, Hints &hints, MiterStats *stats = nullptr);
 
 // Checks if it is possible to construct a miter with given parameters.
 bool areMiterable(GNet &net1, GNet &net2, Hints &hints);
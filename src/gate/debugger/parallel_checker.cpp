@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/encoder.h"
+#include "gate/debugger/parallel_checker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace eda::gate::debugger {
+
+using GateStore = model::GateStore;
+using OutputPair = std::pair<GateId, GateId>;
+
+/// Checks the group of the output pairs (returns false on a mismatch).
+static bool checkGroup(Encoder &encoder,
+                       const OutputPair *begin,
+                       const OutputPair *end,
+                       const std::atomic<bool> &stop) {
+  std::vector<Encoder::VarPair> outputs;
+  outputs.reserve(end - begin);
+
+  for (const auto *pair = begin; pair != end; pair++) {
+    encoder.encodeCone(*Gate::get(pair->first), 0);
+    encoder.encodeCone(*Gate::get(pair->second), 0);
+
+    outputs.push_back({encoder.var(pair->first, 0),
+                       encoder.var(pair->second, 0)});
+  }
+
+  Context::Clause assumptions;
+  assumptions.push(encoder.encodeDiff(outputs));
+
+  // The solver is run w/ a conflict budget to react on the early stop.
+  auto &solver = encoder.context().solver();
+  auto result = Minisat::l_Undef;
+  while (result == Minisat::l_Undef && !stop) {
+    solver.setConfBudget(ParallelChecker::CONFLICT_BUDGET);
+    result = solver.solveLimited(assumptions);
+  }
+
+  encoder.release(assumptions[0]);
+  return result != Minisat::l_True;
+}
+
+bool ParallelChecker::areEqual(GNet &lhs,
+                               GNet &rhs,
+                               GateIdMap &gmap) {
+  if (!lhs.isComb() || !rhs.isComb()) {
+    return Checker::get().areEqual(lhs, rhs, gmap);
+  }
+
+  // The RHS inputs are substituted by the LHS ones.
+  Context::GateConnect connectTo;
+  for (const auto &sourceLink : lhs.sourceLinks()) {
+    connectTo[gmap[sourceLink.target]] = sourceLink.target;
+  }
+
+  std::vector<OutputPair> outputs;
+  outputs.reserve(lhs.nTargetLinks());
+  for (const auto &targetLink : lhs.targetLinks()) {
+    outputs.push_back({targetLink.source, gmap[targetLink.source]});
+  }
+
+  // The neighboring outputs are likely to share their cones.
+  std::sort(outputs.begin(), outputs.end());
+
+  const auto nGroups = (outputs.size() + groupSize - 1) / groupSize;
+  const auto nWorkers = std::min<std::size_t>(nGroups,
+      nThreads > 0 ? nThreads
+                   : std::max(1u, std::thread::hardware_concurrency()));
+
+  std::atomic<std::size_t> next{0};
+  std::atomic<bool> differ{false};
+
+  // The workers read the gates from the store of the calling thread.
+  auto &store = Gate::store();
+
+  const auto work = [&]() {
+    GateStore::Scope scope(store);
+
+    Encoder encoder;
+    encoder.setConnectTo(&connectTo);
+
+    while (!differ) {
+      const auto group = next++;
+      if (group >= nGroups) {
+        break;
+      }
+
+      const auto first = group * groupSize;
+      const auto last = std::min(first + groupSize, outputs.size());
+      const auto *begin = outputs.data() + first;
+      const auto *end = outputs.data() + last;
+
+      if (!checkGroup(encoder, begin, end, differ)) {
+        differ = true;
+      }
+    }
+  };
+
+  if (nWorkers <= 1) {
+    work();
+    return !differ;
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(nWorkers);
+  for (std::size_t i = 0; i < nWorkers; i++) {
+    workers.emplace_back(work);
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  return !differ;
+}
+
+} // namespace eda::gate::debugger
@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "gate/debugger/base_checker.h"
+#include "gate/debugger/checker.h"
+#include "gate/model/gnet.h"
+#include "util/singleton.h"
+
+#include <cstddef>
+
+namespace eda::gate::debugger {
+
+/**
+ * \brief Implements an output-partitioned parallel LEC of combinational nets.
+ *
+ * The output pairs are split into groups, which are checked concurrently
+ * by the worker threads. Each worker owns an incremental SAT encoder and
+ * encodes the transitive fanin cones of its groups' outputs on demand (the
+ * cones shared by the groups of the same worker are encoded once). The
+ * check stops as soon as a worker finds a counterexample.
+ */
+class ParallelChecker final : public BaseChecker,
+                              public util::Singleton<ParallelChecker> {
+  friend class util::Singleton<ParallelChecker>;
+
+public:
+  using GateIdMap = Checker::GateIdMap;
+
+  /// Default number of the output pairs in a group.
+  static constexpr std::size_t DEFAULT_GROUP_SIZE = 8;
+  /// Number of the conflicts between the early termination checks.
+  static constexpr int CONFLICT_BUDGET = 10000;
+
+  bool areEqual(GNet &lhs,
+                GNet &rhs,
+                GateIdMap &gmap) override;
+
+  /// Sets the number of the worker threads (0 stands for all the cores).
+  void setThreads(unsigned nThreads) { this->nThreads = nThreads; }
+
+  /// Sets the number of the output pairs in a group.
+  void setGroupSize(std::size_t groupSize) {
+    this->groupSize = groupSize > 0 ? groupSize : 1;
+  }
+
+private:
+  ParallelChecker() {}
+
+  unsigned nThreads = 0;
+  std::size_t groupSize = DEFAULT_GROUP_SIZE;
+};
+
+} // namespace eda::gate::debugger
@@ -7,6 +7,10 @@
 //===----------------------------------------------------------------------===//
 
 #include "gate/debugger/rnd_checker.h"
+#include "util/random.h"
+
+#include <algorithm>
+#include <chrono>
 
 using GNet = eda::gate::model::GNet;
 
@@ -14,67 +18,92 @@ namespace eda::gate::debugger {
 
 static simulator::Simulator simulator;
 
-Result rndChecker(GNet &miter, const unsigned int tries, const bool exhaustive = true) {
+Result rndChecker(GNet &miter,
+                  const unsigned int tries,
+                  const bool exhaustive,
+                  RndStats *stats,
+                  const uint64_t seed) {
+  using Clock = std::chrono::steady_clock;
+  using W = simulator::Simulator::Compiled::W;
+  using WV = simulator::Simulator::Compiled::WV;
+  constexpr std::uint64_t width = simulator::Simulator::Compiled::WIDTH;
 
   // check the number of outputs
   assert(miter.nTargetLinks() == 1);
 
-  std::uint64_t inputNum = miter.nSourceLinks();
-  assert(inputNum >= 2 && inputNum <= 64);
-
-  GNet::In gnetInput(1);
-  auto &input = gnetInput[0];
-
-  for (auto srcLink : miter.sourceLinks()) {
-    input.push_back(srcLink.target);
+  const std::uint64_t inputNum = miter.nSourceLinks();
+  if (inputNum == 0 || (exhaustive && inputNum >= 64)) {
+    return Result::ERROR;
   }
 
-  Gate::SignalList inputs;
-  Gate::Id outputId = 0;
   GNet::LinkList in;
-
-  for (size_t n = 0; n < inputNum; n++) {
-    in.push_back(GNet::Link(input[n]));
+  for (auto srcLink : miter.sourceLinks()) {
+    in.push_back(GNet::Link(srcLink.target));
   }
 
-  GNet::LinkList out{Gate::Link(outputId)};
-
-  for (auto input : inputs) {
-    in.push_back(GNet::Link(input.node()));
-  }
+  GNet::LinkList out{*miter.targetLinks().begin()};
 
   miter.sortTopologically();
   auto compiled = simulator.compile(miter, in, out);
-  std::uint64_t output;
-  std::uint64_t inputPower = static_cast<std::uint64_t>(1 << (inputNum - 1));
-  
-  if (!exhaustive) {
-    for (std::uint64_t t = 0; t < tries; t++) {
-      for (std::uint64_t i = 0; i < (inputNum - 1); i++) {
-        std::uint64_t temp = 2 * rand();
-        std::uint64_t in = temp % inputPower;
-        compiled.simulate(output, in);
-        if (output == 1) {
-          return  Result::NOTEQUAL;
-        }
-      }
+
+  // Patterns are packed into words: the j-th bit of the i-th word is the
+  // value of the i-th input in the j-th pattern of the batch.
+  WV patterns(inputNum);
+  WV outputs(1);
+
+  RndStats local;
+  RndStats &result = stats ? *stats : local;
+  result = RndStats();
+
+  const auto start = Clock::now();
+
+  // Simulates the batch and returns true iff the miter output is one.
+  const auto check = [&](std::uint64_t nPatterns) {
+    compiled.simulate(outputs, patterns);
+    result.nPatterns += nPatterns;
+
+    const W mask = (nPatterns == width) ? ~0ull : ((1ull << nPatterns) - 1);
+    const W diff = outputs[0] & mask;
+    if (diff == 0) {
+      return false;
     }
-    return Result::UNKNOWN;
-  }
 
+    // Save the failing pattern.
+    const auto j = __builtin_ctzll(diff);
+    for (std::uint64_t i = 0; i < inputNum; i++) {
+      result.counterexample.push_back({in[i].target, (patterns[i] >> j) & 1});
+    }
+    return true;
+  };
+
+  bool mismatch = false;
   if (exhaustive) {
-    for (std::uint64_t t = 0; t < inputPower; t++) {
-      std::uint64_t temp = 2 * t;
-      std::uint64_t in = temp % inputPower;
-      compiled.simulate(output, in);
-      if (output == 1) {
-        return Result::NOTEQUAL;
+    const std::uint64_t nCombinations = 1ull << inputNum;
+    const std::uint64_t nBlocks = (nCombinations + width - 1) / width;
+
+    for (std::uint64_t block = 0; block < nBlocks && !mismatch; block++) {
+      for (std::uint64_t i = 0; i < inputNum; i++) {
+        patterns[i] = simulator::Simulator::Compiled::exhaustive(i, block);
       }
+      mismatch = check(std::min(width, nCombinations - block * width));
+    }
+  } else {
+    utils::Xoshiro256 generator(seed);
+
+    for (std::uint64_t t = 0; t < tries && !mismatch; t += width) {
+      for (std::uint64_t i = 0; i < inputNum; i++) {
+        patterns[i] = generator();
+      }
+      mismatch = check(std::min<std::uint64_t>(width, tries - t));
     }
-    return Result::EQUAL;
   }
 
-  return Result::ERROR;
+  result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  if (mismatch) {
+    return Result::NOTEQUAL;
+  }
+  return exhaustive ? Result::EQUAL : Result::UNKNOWN;
 }
 
 void RndChecker::setTries(int tries) {
@@ -85,6 +114,10 @@ void RndChecker::setExhaustive(bool exhaustive) {
   this->exhaustive = exhaustive;
 }
 
+void RndChecker::setSeed(uint64_t seed) {
+  this->seed = seed;
+}
+
 bool RndChecker::areEqual(GNet &lhs,
                           GNet &rhs,
                           Checker::GateIdMap &gmap) {
@@ -115,7 +148,8 @@ bool RndChecker::areEqual(GNet &lhs,
     hints.triggerBinding = std::make_shared<GateBinding>(std::move(tbind));
 
     GNet *net = miter(lhs, rhs, hints);
-    Result res = rndChecker(*net, tries, exhaustive);
+    Result res = rndChecker(*net, tries, exhaustive, &stats, seed);
+
     return (res == 0);
   }
 
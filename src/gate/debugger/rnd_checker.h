@@ -16,6 +16,9 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 using GNet = eda::gate::model::GNet;
 
@@ -33,14 +36,41 @@ enum Result {
   NOTEQUAL = 1,
 };
 
+/// Statistics of the random-simulation check.
+struct RndStats final {
+  /// Number of the simulated patterns.
+  uint64_t nPatterns = 0;
+  /// Simulation time (in seconds).
+  double seconds = 0;
+  /// Input values of the failing pattern (empty if there is no mismatch).
+  std::vector<std::pair<Gate::Id, bool>> counterexample;
+
+  /// Returns the simulation throughput.
+  double patternsPerSecond() const {
+    return seconds > 0 ? nPatterns / seconds : 0;
+  }
+};
+
 /**
  *  \brief Goes through values and checks miter output.
+ *
+ *  The patterns are simulated in batches of 64 (one bit per pattern); in the
+ *  random mode, they are generated by the seeded xoshiro256** generator, so
+ *  the number of the miter inputs is not limited. The exhaustive mode is
+ *  supported for the miters w/ less than 64 inputs.
+ *
  *  @param miter Miter which will receive values.
  *  @param tries Number of random values checked, if the check is inexhaustive.
  *  @param exhaustive Sets the mode of the check.
+ *  @param stats Statistics to be filled (optional).
+ *  @param seed Seed of the random generator.
  *  @return The result of the check.
  */
-Result rndChecker(GNet &miter, const unsigned int tries, const bool exhaustive);
+Result rndChecker(GNet &miter,
+                  const unsigned int tries,
+                  const bool exhaustive,
+                  RndStats *stats = nullptr,
+                  const uint64_t seed = 0);
 
 class RndChecker : public BaseChecker, public util::Singleton<RndChecker> {
 friend class util::Singleton<RndChecker>;
@@ -51,9 +81,15 @@ public:
                 Checker::GateIdMap &gmap) override;
   void setTries(int tries);
   void setExhaustive(bool exhaustive);
+  void setSeed(uint64_t seed);
+
+  /// Returns the statistics of the last check.
+  const RndStats &getStats() const { return stats; }
 private:
   int tries = 0;
   bool exhaustive = true;
+  uint64_t seed = 0;
+  RndStats stats;
 };
 
 } // namespace eda::gate::debugger
@@ -30,6 +30,7 @@ public:
 
   unsigned cycle() const { return _cycle; }
   Context& context() { return _encoder.context(); }
+  Encoder& encoder() { return _encoder; }
 
 private:
   unsigned _cycle;
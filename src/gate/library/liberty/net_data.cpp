@@ -35,13 +35,25 @@ static std::shared_ptr<GModel::GNet> makeNet(
   return net;
 }
 
+void NetData::buildCells() {
+  cells.clear();
+  cells.reserve(combNets.size());
+  for (auto &net: combNets) {
+    cells.push_back({NetData::buildTruthTab(net.get())[0],
+                     net->nSourceLinks()});
+  }
+}
+
 void NetData::fillDatabase(RWDatabase &database) {
+  if (cells.size() != combNets.size()) {
+    buildCells();
+  }
+
   std::unordered_map<RWDatabase::TruthTable, RWDatabase::BoundGNetList> storage;
-  for (auto &net: combNets) {
-    std::uint64_t N = net->nSourceLinks();
+  for (const auto &cell: cells) {
     Gate::SignalList inputs1;
     Gate::Id outputId1;
-    auto newNet = makeNet(GateSymbol::AND, N, inputs1, outputId1);
+    auto newNet = makeNet(GateSymbol::AND, cell.nInputs, inputs1, outputId1);
     RWDatabase::BoundGNet bounder;
     std::uint64_t id = 0;
     for (auto link: newNet->sourceLinks()) {
@@ -49,9 +61,8 @@ void NetData::fillDatabase(RWDatabase &database) {
       bounder.bindings.emplace(id, link.target);
       ++id;
     }
-    bounder.net.reset(newNet.get());
-    RWDatabase::TruthTable key = NetData::buildTruthTab(net.get())[0];
-    storage[key].push_back(bounder);
+    bounder.net = newNet;
+    storage[cell.table].push_back(bounder);
   }
   for (auto &it: storage) {
     database.set(it.first, it.second);
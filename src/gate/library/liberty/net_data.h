@@ -11,6 +11,7 @@
 #include "gate/model/gnet.h"
 #include "gate/optimizer/rwdatabase.h"
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -23,10 +24,24 @@
 /// and memory Nets.
 struct NetData {
 
+  /// Combinational cell: truth table and number of inputs.
+  struct Cell {
+    eda::gate::optimizer::RWDatabase::TruthTable table;
+    std::uint64_t nInputs;
+  };
+
   std::vector<std::unique_ptr<eda::gate::model::GNet>> combNets;
   std::vector<std::unique_ptr<eda::gate::model::GNet>> memNets;
 
-  /// Is used for filling database only combNets.
+  /// Cells of combNets (see buildCells()).
+  std::vector<Cell> cells;
+
+  /// Computes the cells of combNets. Must be called in the gate store of
+  /// the nets; then the database can be filled in any store.
+  void buildCells();
+
+  /// Is used for filling database only combNets (the cells are computed
+  /// if they have not been computed yet).
   void fillDatabase(
       eda::gate::optimizer::RWDatabase &database);
 
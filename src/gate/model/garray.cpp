@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/model/garray.h"
+
+#include <algorithm>
+
+namespace eda::gate::model {
+
+GArray::GArray(const GNet &net) {
+  const auto n = net.nGates();
+
+  _id.reserve(n);
+  _func.reserve(n);
+  _flags.reserve(n);
+  _faninOffset.reserve(n + 1);
+  _faninId.reserve(net.nConnects() + net.nSourceLinks());
+
+  // The identifiers of the net's gates are usually contiguous in the store.
+  if (n != 0) {
+    GateId minId = Gate::INVALID, maxId = 0;
+    for (const auto *gate : net.gates()) {
+      minId = std::min(minId, gate->id());
+      maxId = std::max(maxId, gate->id());
+    }
+    _base = minId;
+    _index.resize(maxId - minId + 1, EXTERNAL);
+  }
+
+  // Gates and fanin identifiers.
+  _faninOffset.push_back(0);
+  for (const auto *gate : net.gates()) {
+    _index[gate->id() - _base] = _id.size();
+    _id.push_back(gate->id());
+    _func.push_back(gate->func());
+    _flags.push_back((gate->isSource()  ? SOURCE  : 0) |
+                     (gate->isTarget()  ? TARGET  : 0) |
+                     (gate->isValue()   ? VALUE   : 0) |
+                     (gate->isTrigger() ? TRIGGER : 0));
+
+    for (const auto &input : gate->inputs()) {
+      _faninId.push_back(input.node());
+    }
+    _faninOffset.push_back(_faninId.size());
+  }
+
+  // Fanin indices and fanout counters.
+  std::vector<Index> nFanouts(n + 1, 0);
+
+  _fanin.resize(_faninId.size());
+  for (std::size_t k = 0; k < _faninId.size(); k++) {
+    const auto i = index(_faninId[k]);
+    _fanin[k] = i;
+
+    if (i != EXTERNAL) {
+      nFanouts[i + 1]++;
+    }
+  }
+
+  // Fanout offsets.
+  _fanoutOffset.resize(n + 1, 0);
+  for (std::size_t i = 0; i < n; i++) {
+    _fanoutOffset[i + 1] = _fanoutOffset[i] + nFanouts[i + 1];
+  }
+
+  // Fanout indices (ordered by the successor indices).
+  _fanout.resize(_fanoutOffset[n]);
+  std::vector<Index> position(_fanoutOffset.begin(), _fanoutOffset.end() - 1);
+  for (Index i = 0; i < n; i++) {
+    for (auto k = _faninOffset[i]; k < _faninOffset[i + 1]; k++) {
+      const auto j = _fanin[k];
+      if (j != EXTERNAL) {
+        _fanout[position[j]++] = i;
+      }
+    }
+  }
+}
+
+} // namespace eda::gate::model
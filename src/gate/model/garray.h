@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "gate/model/gnet.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace eda::gate::model {
+
+/**
+ * \brief Struct-of-arrays snapshot of a gate-level net.
+ *
+ * The gates are numbered by dense indices (in the order of GNet::gates(),
+ * i.e. topologically if the net is sorted). The gate functions and flags
+ * are stored in contiguous arrays; the fanins and fanouts are stored in
+ * the CSR format. The identifiers are mapped to the indices by a dense
+ * table covering the identifier range of the net. The snapshot is not
+ * updated when the net is modified.
+ */
+class GArray final {
+public:
+  using GateId = Gate::Id;
+  using Index = std::uint32_t;
+
+  /// Index of a fanin that does not belong to the net.
+  static constexpr Index EXTERNAL = -1u;
+
+  /// Gate flags.
+  enum Flag : std::uint8_t {
+    SOURCE  = 1 << 0,
+    TARGET  = 1 << 1,
+    VALUE   = 1 << 2,
+    TRIGGER = 1 << 3
+  };
+
+  /// Builds the snapshot of the given net.
+  explicit GArray(const GNet &net);
+
+  /// Returns the number of gates.
+  std::size_t nGates() const { return _id.size(); }
+
+  /// Returns the index of the gate (or EXTERNAL).
+  Index index(GateId gid) const {
+    // The unsigned difference is out of range for gid < _base.
+    const std::size_t k = gid - _base;
+    return k < _index.size() ? _index[k] : EXTERNAL;
+  }
+
+  /// Returns the identifier of the i-th gate.
+  GateId id(Index i) const { return _id[i]; }
+  /// Returns the function of the i-th gate.
+  GateSymbol func(Index i) const { return _func[i]; }
+  /// Returns the flags of the i-th gate.
+  std::uint8_t flags(Index i) const { return _flags[i]; }
+
+  bool isSource(Index i)  const { return _flags[i] & SOURCE; }
+  bool isTarget(Index i)  const { return _flags[i] & TARGET; }
+  bool isValue(Index i)   const { return _flags[i] & VALUE; }
+  bool isTrigger(Index i) const { return _flags[i] & TRIGGER; }
+
+  /// Returns the number of inputs of the i-th gate.
+  std::size_t arity(Index i) const {
+    return _faninOffset[i + 1] - _faninOffset[i];
+  }
+
+  /// Returns the index of the j-th input of the i-th gate (or EXTERNAL).
+  Index fanin(Index i, std::size_t j) const {
+    return _fanin[_faninOffset[i] + j];
+  }
+
+  /// Returns the identifier of the j-th input of the i-th gate.
+  GateId faninId(Index i, std::size_t j) const {
+    return _faninId[_faninOffset[i] + j];
+  }
+
+  /// Returns the number of the i-th gate's successors in the net.
+  std::size_t fanout(Index i) const {
+    return _fanoutOffset[i + 1] - _fanoutOffset[i];
+  }
+
+  /// Returns the index of the j-th successor of the i-th gate.
+  Index fanout(Index i, std::size_t j) const {
+    return _fanout[_fanoutOffset[i] + j];
+  }
+
+private:
+  /// Gate identifiers.
+  std::vector<GateId> _id;
+  /// Gate functions.
+  std::vector<GateSymbol> _func;
+  /// Gate flags.
+  std::vector<std::uint8_t> _flags;
+
+  /// Fanin offsets (CSR): the inputs of the i-th gate are stored
+  /// in [_faninOffset[i], _faninOffset[i + 1]).
+  std::vector<Index> _faninOffset;
+  /// Fanin indices.
+  std::vector<Index> _fanin;
+  /// Fanin identifiers.
+  std::vector<GateId> _faninId;
+
+  /// Fanout offsets (CSR).
+  std::vector<Index> _fanoutOffset;
+  /// Fanout indices.
+  std::vector<Index> _fanout;
+
+  /// Minimal gate identifier.
+  GateId _base = 0;
+  /// Maps gate identifiers (minus the base) to indices (or EXTERNAL).
+  std::vector<Index> _index;
+};
+
+} // namespace eda::gate::model
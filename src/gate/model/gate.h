@@ -27,6 +27,9 @@ class GNet;
 
 using GateBase = eda::base::model::Node<GateSymbol, true>;
 
+/// Per-design gate table (see GateBase::Store).
+using GateStore = GateBase::Store;
+
 /**
  * \brief Represents a logic gate or a flip-flop/latch.
  * \author <a href="mailto:kamkin@ispras.ru">Alexander Kamkin</a>
@@ -54,6 +57,11 @@ public:
     GateBase::add(netId, gate);
   }
 
+  /// Removes the gate from the hash table.
+  static void remove(uint32_t netId, Gate *gate) {
+    GateBase::remove(netId, gate);
+  }
+
   bool isSource() const {
     return _func == GateSymbol::IN;
   }
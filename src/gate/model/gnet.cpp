@@ -23,7 +23,7 @@ namespace eda::gate::model {
 // Constructors/Destructors
 //===----------------------------------------------------------------------===//
 
-unsigned GNet::_counter = 0;
+std::atomic<unsigned> GNet::_counter{0};
 
 GNet::GNet(unsigned level):
     _id(_counter++),
@@ -134,7 +134,7 @@ GNet::GateId GNet::addGate(Gate *gate, SubnetId sid) {
   unsigned gindex = _gates.size();
   _gates.push_back(gate);
 
-  GateFlags flags{0, sid, gindex};
+  GateFlags flags{0, sid, gindex, 0, 0, 0};
   _flags.insert({gid, flags});
 
   onAddGate(gate, true, false);
@@ -168,6 +168,8 @@ void GNet::setGate(GateId gid, GateSymbol func, const SignalList &inputs) {
 
   std::for_each(subnets.begin(), subnets.end(), [=](GNet *subnet) {
     subnet->onRemoveGate(gate, true, true);
+    // The hash table entry is keyed by the old function/inputs.
+    Gate::remove(subnet->_id, gate);
   });
 
   gate->setFunc(func);
@@ -176,6 +178,7 @@ void GNet::setGate(GateId gid, GateSymbol func, const SignalList &inputs) {
 
   std::for_each(subnets.rbegin(), subnets.rend(), [=](GNet *subnet) {
     subnet->onAddGate(gate, true, true);
+    Gate::add(subnet->_id, gate);
   });
 
   // Do some integrity checks.
@@ -218,6 +221,12 @@ void GNet::removeGate(GateId gid) {
   onRemoveGate(gate, true, false);
   _flags.erase(i);
 
+  // Structural hashing.
+  Gate::remove(_id, gate);
+
+  // The fanouts may lose the critical input.
+  updateFanoutLevels(gate);
+
   // Do some integrity checks.
   assert((_sourceLinks.empty() &&
           _targetLinks.empty() &&
@@ -240,6 +249,12 @@ void GNet::onAddGate(Gate *gate, bool updateBoundary, bool withLinks) {
 
   _nConnects += gate->arity();
   _isSorted = (_gates.size() <= 1);
+
+  updateInputRefs(gate, true);
+  getFlags(gid).refs = countRefs(gate);
+
+  attachLevel(gid, computeLevel(gate));
+  updateFanoutLevels(gate);
 }
 
 void GNet::onRemoveGate(Gate *gate, bool updateBoundary, bool withLinks) {
@@ -257,6 +272,140 @@ void GNet::onRemoveGate(Gate *gate, bool updateBoundary, bool withLinks) {
 
   _nConnects -= gate->arity();
   _isSorted = (_gates.size() <= 1);
+
+  updateInputRefs(gate, false);
+  detachLevel(gid);
+}
+
+//===----------------------------------------------------------------------===//
+// Logic Levels
+//===----------------------------------------------------------------------===//
+
+GNet::GateIdList GNet::topologicalOrder() const {
+  GateIdList order;
+  order.reserve(_gates.size());
+
+  for (const auto &gates : _levelGates) {
+    order.insert(std::end(order), std::begin(gates), std::end(gates));
+  }
+
+  return order;
+}
+
+unsigned GNet::computeLevel(const Gate *gate) const {
+  if (gate->isSource() || gate->isValue() || gate->isTrigger()) {
+    return 0;
+  }
+
+  unsigned level = 0;
+  for (const auto input : gate->inputs()) {
+    const auto i = _flags.find(input.node());
+    if (i != _flags.end()) {
+      level = std::max<unsigned>(level, i->second.level + 1);
+    }
+  }
+
+  return level;
+}
+
+void GNet::attachLevel(GateId gid, unsigned level) {
+  if (_levelGates.size() <= level) {
+    _levelGates.resize(level + 1);
+  }
+
+  auto &flags = getFlags(gid);
+  flags.level = level;
+  flags.lindex = _levelGates[level].size();
+
+  _levelGates[level].push_back(gid);
+}
+
+void GNet::detachLevel(GateId gid) {
+  const GateFlags flags = getFlags(gid);
+  auto &gates = _levelGates[flags.level];
+
+  const auto last = gates.back();
+  gates[flags.lindex] = last;
+  getFlags(last).lindex = flags.lindex;
+  gates.pop_back();
+
+  while (!_levelGates.empty() && _levelGates.back().empty()) {
+    _levelGates.pop_back();
+  }
+}
+
+void GNet::updateFanoutLevels(const Gate *gate) {
+  // The gates are processed in ascending order of their levels,
+  // so that a gate is usually updated once.
+  using Entry = std::pair<unsigned, GateId>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+
+  const auto schedule = [this, &queue](const Gate *source) {
+    for (auto link : source->links()) {
+      const auto i = _flags.find(link.target);
+      if (i != _flags.end() && !Gate::get(link.target)->isTrigger()) {
+        const unsigned level = i->second.level;
+        queue.push({level, link.target});
+      }
+    }
+  };
+
+  schedule(gate);
+
+  while (!queue.empty()) {
+    const auto gid = queue.top().second;
+    queue.pop();
+
+    const auto *target = Gate::get(gid);
+    const auto level = computeLevel(target);
+
+    // A level above the number of gates means a combinational cycle.
+    if (level != getFlags(gid).level && level <= _gates.size()) {
+      detachLevel(gid);
+      attachLevel(gid, level);
+      schedule(target);
+    }
+  }
+}
+
+void GNet::rebuildLevels() {
+  _levelGates.clear();
+
+  std::unordered_set<GateId> visited;
+  visited.reserve(_gates.size());
+
+  // The flag indicates whether the gate inputs have been pushed.
+  std::vector<std::pair<const Gate*, bool>> stack;
+
+  for (const auto *root : _gates) {
+    stack.push_back({root, false});
+
+    while (!stack.empty()) {
+      const auto [gate, expanded] = stack.back();
+      stack.pop_back();
+
+      if (expanded) {
+        attachLevel(gate->id(), computeLevel(gate));
+        continue;
+      }
+
+      if (!visited.insert(gate->id()).second) {
+        continue;
+      }
+
+      stack.push_back({gate, true});
+      if (gate->isTrigger()) {
+        continue;
+      }
+
+      for (const auto input : gate->inputs()) {
+        const auto gid = input.node();
+        if (contains(gid) && visited.find(gid) == visited.end()) {
+          stack.push_back({Gate::get(gid), false});
+        }
+      }
+    }
+  }
 }
 
 void GNet::updateBoundaryLinksOnAdd(Gate *gate, bool withLinks) {
@@ -349,6 +498,40 @@ void GNet::updateBoundaryLinksOnRemove(Gate *gate, bool withLinks) {
   }
 }
 
+//===----------------------------------------------------------------------===//
+// Reference Counters
+//===----------------------------------------------------------------------===//
+
+unsigned GNet::countRefs(const Gate *gate) const {
+  unsigned refs = 0;
+  for (auto link : gate->links()) {
+    if (contains(link.target)) {
+      refs++;
+    }
+  }
+
+  return refs;
+}
+
+void GNet::updateInputRefs(const Gate *gate, bool inc) {
+  for (const auto input : gate->inputs()) {
+    // The self-loops are counted via the gate's links.
+    if (input.node() == gate->id()) {
+      continue;
+    }
+
+    const auto i = _flags.find(input.node());
+    if (i != _flags.end()) {
+      if (inc) {
+        i->second.refs++;
+      } else {
+        assert(i->second.refs > 0);
+        i->second.refs--;
+      }
+    }
+  }
+}
+
 //===----------------------------------------------------------------------===//
 // Subnets
 //===----------------------------------------------------------------------===//
@@ -401,6 +584,13 @@ void GNet::addNet(const GNet &net) {
 
     _flags.insert({gid, newFlags});
   }
+
+  // The nets may be connected to each other.
+  rebuildLevels();
+
+  for (const auto *gate : _gates) {
+    getFlags(gate->id()).refs = countRefs(gate);
+  }
 }
 
 GNet::SubnetId GNet::addSubnet(GNet *subnet) {
@@ -545,6 +735,11 @@ void GNet::removeEmptySubnets() {
 }
 
 void GNet::clear() {
+  // Structural hashing.
+  for (auto *gate : _gates) {
+    Gate::remove(_id, gate);
+  }
+
   _gates.clear();
   _flags.clear();
   _sourceLinks.clear();
@@ -554,6 +749,8 @@ void GNet::clear() {
   _subnets.clear();
   _emptySubnets.clear();
 
+  _levelGates.clear();
+
   _nConnects = _nGatesInSubnets = 0;
   _isSorted = true;
 }
@@ -633,17 +830,17 @@ void GNet::sortTopologically() {
 
   _isSorted = true;
 
-  // If the net is flat, sort the gates and update the indices.
+  // If the net is flat, order the gates by levels and update the indices.
   if (isFlat()) {
-    auto gates = topologicalSort<GNet>(*this);
-
-    for (size_t i = 0; i < gates.size(); i++) {
-      auto gid = gates[i];
-
-      _gates[i] = Gate::get(gid);
-      getFlags(gid).gindex = i;
+    size_t i = 0;
+    for (const auto &gates : _levelGates) {
+      for (auto gid : gates) {
+        _gates[i] = Gate::get(gid);
+        getFlags(gid).gindex = i++;
+      }
     }
 
+    assert(i == _gates.size());
     return;
   }
 
@@ -10,6 +10,7 @@
 
 #include "gate/model/gate.h"
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <set>
@@ -101,6 +102,12 @@ public:
     unsigned subnet : 20;
     /// Local index of the gate.
     unsigned gindex : 32;
+    /// Logic level of the gate.
+    unsigned level : 32;
+    /// Index of the gate within its logic level.
+    unsigned lindex : 32;
+    /// Number of the gate's fanouts inside the net.
+    unsigned refs : 32;
   };
   #pragma pack(pop)
 
@@ -295,6 +302,55 @@ public:
   /// Moves the gate outside the net keeping the links unchanged.
   void removeGate(GateId gid);
 
+  //===--------------------------------------------------------------------===//
+  // Logic Levels
+  //===--------------------------------------------------------------------===//
+
+  /// Returns the logic level of the gate: 0 for the inputs, the constants,
+  /// the triggers, and the gates w/o inputs inside the net; otherwise,
+  /// 1 + the maximum level of the gate's inputs inside the net. The levels
+  /// are maintained incrementally as the gates are added/modified/removed
+  /// (on combinational cycles, they do not exceed the number of gates).
+  unsigned getLogicLevel(GateId gid) const {
+    return getFlags(gid).level;
+  }
+
+  /// Returns the number of logic levels.
+  size_t nLogicLevels() const {
+    return _levelGates.size();
+  }
+
+  /// Returns the gates of the given logic level.
+  const GateIdList &levelGates(unsigned level) const {
+    return _levelGates[level];
+  }
+
+  /// Returns the gates in topological order (level by level).
+  GateIdList topologicalOrder() const;
+
+  //===--------------------------------------------------------------------===//
+  // Reference Counters
+  //===--------------------------------------------------------------------===//
+
+  /// Returns the number of the gate's fanouts inside the net. The counters
+  /// are maintained as the gates are added/modified/removed; they may be
+  /// temporarily modified (e.g., to label an MFFC) but must be restored.
+  unsigned getRefs(GateId gid) const {
+    return getFlags(gid).refs;
+  }
+
+  /// Increments the gate's reference counter and returns the new value.
+  unsigned incRefs(GateId gid) {
+    return ++getFlags(gid).refs;
+  }
+
+  /// Decrements the gate's reference counter and returns the new value.
+  unsigned decRefs(GateId gid) {
+    auto &flags = getFlags(gid);
+    assert(flags.refs > 0);
+    return --flags.refs;
+  }
+
   //===--------------------------------------------------------------------===//
   // Modification Methods
   //===--------------------------------------------------------------------===//
@@ -611,6 +667,22 @@ private:
   /// Updates the net state when removing a gate.
   void onRemoveGate(Gate *gate, bool updateBoundary, bool withLinks);
 
+  /// Computes the logic level of the gate from the levels of its inputs.
+  unsigned computeLevel(const Gate *gate) const;
+  /// Places the gate to the given logic level.
+  void attachLevel(GateId gid, unsigned level);
+  /// Removes the gate from its logic level.
+  void detachLevel(GateId gid);
+  /// Updates the logic levels of the gate's transitive fanout.
+  void updateFanoutLevels(const Gate *gate);
+  /// Recomputes the logic levels of all the gates.
+  void rebuildLevels();
+
+  /// Counts the gate's fanouts inside the net.
+  unsigned countRefs(const Gate *gate) const;
+  /// Updates the reference counters of the gate's inputs.
+  void updateInputRefs(const Gate *gate, bool inc);
+
   /// Updates the source/target links when adding a gate.
   void updateBoundaryLinksOnAdd(Gate *gate, bool withLinks);
   /// Updates the source/target links when removing a gate.
@@ -652,11 +724,14 @@ private:
   /// Number of gates that belong to subnets.
   size_t _nGatesInSubnets;
 
+  /// Gates grouped by logic levels.
+  std::vector<GateIdList> _levelGates;
+
   /// Flag indicating that the net is topologically sorted.
   bool _isSorted;
 
   /// Counter for identifier initialization.
-  static unsigned _counter;
+  static std::atomic<unsigned> _counter;
 };
 
 /// Outputs the net.
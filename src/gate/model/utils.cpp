@@ -25,29 +25,49 @@ Gate::SignalList getNewInputs(const Gate::SignalList &oldInputs,
   return newInputs;
 }
 
-Gate::SignalList getNewInputs(const Gate &oldGate,
+Gate::SignalList getNewInputs(const GArray &array,
+                              GArray::Index i,
+                              const std::vector<Gate::Id> &newIds,
                               const GNet::GateIdMap &oldToNewGates,
                               size_t &n0,
                               size_t &n1) {
-  const auto k = oldGate.arity();
+  const auto k = array.arity(i);
 
   Gate::SignalList newInputs;
   newInputs.reserve(k);
 
   n0 = 0;
   n1 = 0;
-  for (const auto input : oldGate.inputs()) {
-    if (model::isValue(input)) {
-      const auto isZero = model::isZero(input);
+  for (size_t j = 0; j < k; j++) {
+    const auto fanin = array.fanin(i, j);
+
+    bool isValue, isZero;
+    if (fanin != GArray::EXTERNAL) {
+      isValue = array.isValue(fanin);
+      isZero = array.func(fanin) == GateSymbol::ZERO;
+    } else {
+      const auto input = Gate::Signal::always(array.faninId(i, j));
+      isValue = model::isValue(input);
+      isZero = model::isZero(input);
+    }
+
+    if (isValue) {
       n0 += (isZero ? 1 : 0);
       n1 += (isZero ? 0 : 1);
-    } else {
-      const auto i = oldToNewGates.find(input.node());
-      assert((i != oldToNewGates.end()) && "The gate was not found");
+      continue;
+    }
 
-      const auto newInputId = i->second;
-      newInputs.push_back(Gate::Signal::always(newInputId));
+    Gate::Id newInputId;
+    if (fanin != GArray::EXTERNAL) {
+      newInputId = newIds[fanin];
+    } else {
+      const auto found = oldToNewGates.find(array.faninId(i, j));
+      assert((found != oldToNewGates.end()) && "The gate was not found");
+      newInputId = found->second;
     }
+    assert((newInputId != Gate::INVALID) && "The gate was not mapped");
+
+    newInputs.push_back(Gate::Signal::always(newInputId));
   }
 
   return newInputs;
@@ -8,14 +8,23 @@
 
 #pragma once
 
+#include "gate/model/garray.h"
 #include "gate/model/gnet.h"
 
+#include <vector>
+
 namespace eda::gate::model {
 
 Gate::SignalList getNewInputs(const Gate::SignalList &oldInputs,
                               const GNet::GateIdMap &oldToNewGates);
 
-Gate::SignalList getNewInputs(const Gate &oldGate,
+/// Returns the new inputs of the i-th gate of the array w/o the constants
+/// (n0 and n1 are the numbers of the zero and one inputs). The new gates
+/// are taken from newIds for the array's gates and from oldToNewGates for
+/// the external ones.
+Gate::SignalList getNewInputs(const GArray &array,
+                              GArray::Index i,
+                              const std::vector<Gate::Id> &newIds,
                               const GNet::GateIdMap &oldToNewGates,
                               size_t &n0,
                               size_t &n1);
@@ -2,7 +2,7 @@
 //
 // Part of the Utopia EDA Project, under the Apache License v2.0
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2023 ISP RAS (http://www.ispras.ru)
+// Copyright 2023-2026 ISP RAS (http://www.ispras.ru)
 //
 //===----------------------------------------------------------------------===//
 
@@ -10,7 +10,11 @@
 
 #include "gate/model/gnet.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <unordered_map>
+#include <vector>
 
 namespace eda::gate::optimizer {
 /**
@@ -21,21 +25,119 @@ namespace eda::gate::optimizer {
     using GNet = model::GNet;
     using GateID = GNet::GateId;
 
-    struct HashFunction {
-      size_t operator()(const std::unordered_set<GateID> &set) const {
-        std::hash<int> hasher;
-        size_t answer = 0;
+    /**
+     * \brief Cut represented as a sorted array of leaves w/ a signature.
+     *
+     * The signature is a 64-bit Bloom filter of the leaves: if the
+     * signature of a cut is not a subset of another cut's signature,
+     * the cut is not a subset of that cut.
+     */
+    struct Cut final {
+      using const_iterator = const GateID*;
+      using iterator = const_iterator;
 
-        for (int i: set) {
-          answer ^= hasher(i) + 0x9e3779b9 +
-                    (answer << 6) + (answer >> 2);
+      /// Maximum number of leaves.
+      static constexpr size_t MAX_SIZE = 8;
+
+      /// Maximum number of leaves for which the truth table is computed.
+      static constexpr size_t MAX_TABLE_SIZE = 6;
+
+      Cut() = default;
+
+      /// Constructs the trivial cut of the node.
+      explicit Cut(GateID node):
+          nLeaves(1), signature(bit(node)), table(0xaaaaaaaaaaaaaaaaull) {
+        leaves[0] = node;
+      }
+
+      /// Returns the signature bit of the node.
+      static uint64_t bit(GateID node) {
+        return 1ull << (node & 63);
+      }
+
+      const_iterator begin() const { return leaves; }
+      const_iterator end() const { return leaves + nLeaves; }
+
+      size_t size() const { return nLeaves; }
+      bool empty() const { return nLeaves == 0; }
+
+      /// Returns the iterator to the leaf (or end()).
+      const_iterator find(GateID node) const {
+        if (!(signature & bit(node))) {
+          return end();
+        }
+        const auto i = std::lower_bound(begin(), end(), node);
+        return (i != end() && *i == node) ? i : end();
+      }
+
+      size_t count(GateID node) const {
+        return find(node) != end() ? 1 : 0;
+      }
+
+      /// Checks whether the cut is a subset of the given one.
+      bool dominates(const Cut &other) const {
+        if (nLeaves > other.nLeaves || (signature & ~other.signature)) {
+          return false;
         }
-        return answer;
+        return std::includes(other.begin(), other.end(), begin(), end());
       }
+
+      /// Merges the cuts if the result has at most k leaves.
+      static bool merge(const Cut &lhs, const Cut &rhs, size_t k, Cut &out) {
+        assert(k <= MAX_SIZE);
+
+        const uint64_t signature = lhs.signature | rhs.signature;
+        if (static_cast<size_t>(__builtin_popcountll(signature)) > k) {
+          return false;
+        }
+
+        size_t i = 0, j = 0, n = 0;
+        while (i < lhs.nLeaves || j < rhs.nLeaves) {
+          if (n == k) {
+            return false;
+          }
+
+          GateID node;
+          if (j == rhs.nLeaves ||
+              (i < lhs.nLeaves && lhs.leaves[i] < rhs.leaves[j])) {
+            node = lhs.leaves[i++];
+          } else if (i == lhs.nLeaves || rhs.leaves[j] < lhs.leaves[i]) {
+            node = rhs.leaves[j++];
+          } else {
+            node = lhs.leaves[i++];
+            j++;
+          }
+          out.leaves[n++] = node;
+        }
+
+        out.nLeaves = n;
+        out.signature = signature;
+        return true;
+      }
+
+      bool operator ==(const Cut &other) const {
+        return signature == other.signature
+            && std::equal(begin(), end(), other.begin(), other.end());
+      }
+
+      bool operator !=(const Cut &other) const {
+        return !(*this == other);
+      }
+
+      /// Sorted leaves.
+      GateID leaves[MAX_SIZE];
+      /// Number of leaves.
+      uint32_t nLeaves = 0;
+      /// Signature of the leaves.
+      uint64_t signature = 0;
+      /// Truth table of the node w.r.t. the leaves (the i-th leaf is the
+      /// i-th variable); valid if the cut has at most MAX_TABLE_SIZE leaves.
+      uint64_t table = 0;
+      /// Cost of the cut (the less the better).
+      float cost = 0;
     };
 
-    using Cut = std::unordered_set<GateID>;
-    using Cuts = std::unordered_set<Cut, HashFunction>;
+    using Cuts = std::vector<Cut>;
 
     std::unordered_map<GateID, Cuts> cuts;
   };
@@ -0,0 +1,384 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/model/garray.h"
+#include "gate/optimizer/cuts_finder.h"
+#include "gate/optimizer/npn.h"
+#include "gate/optimizer/ttbuilder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace eda::gate::optimizer {
+
+using GArray = model::GArray;
+using Gate = model::Gate;
+using GateStore = model::GateStore;
+
+CutsFinder::CutsFinder(int cutSize,
+                       std::size_t maxCuts,
+                       CostFunction cost,
+                       unsigned nThreads):
+    cutSize(std::min<std::size_t>(cutSize, Cut::MAX_SIZE)),
+    maxCuts(maxCuts),
+    cost(cost ? cost : leafCost),
+    nThreads(nThreads ? nThreads
+                      : std::max(1u, std::thread::hardware_concurrency())) {
+  assert(cutSize > 0);
+}
+
+/// Checks whether the gate function is a combinational built-in one (the cuts
+/// do not pass through the other gates, since their tables are unknown).
+static bool isCombinational(model::GateSymbol func) {
+  using GateSymbol = model::GateSymbol;
+
+  switch (func) {
+  case GateSymbol::IN:
+  case GateSymbol::OUT:
+  case GateSymbol::ZERO:
+  case GateSymbol::ONE:
+  case GateSymbol::NOP:
+  case GateSymbol::NOT:
+  case GateSymbol::AND:
+  case GateSymbol::OR:
+  case GateSymbol::XOR:
+  case GateSymbol::NAND:
+  case GateSymbol::NOR:
+  case GateSymbol::XNOR:
+  case GateSymbol::MAJ:
+    return true;
+  default:
+    return false;
+  }
+}
+
+uint64_t CutsFinder::expand(const Cut &cut, const Cut &superset) {
+  assert(cut.dominates(superset));
+  assert(superset.size() <= Cut::MAX_TABLE_SIZE);
+
+  // Move the variables to their positions starting from the last one.
+  auto table = cut.table;
+  for (std::size_t i = cut.size(); i > 0; i--) {
+    const auto j = superset.find(cut.leaves[i - 1]) - superset.begin();
+    for (std::size_t k = i - 1; k < static_cast<std::size_t>(j); k++) {
+      table = NpnCanonizer::swap(table, k);
+    }
+  }
+
+  return table;
+}
+
+void CutsFinder::add(Cuts &cuts, const Cut &cut) {
+  for (const auto &other : cuts) {
+    if (other.dominates(cut)) {
+      return;
+    }
+  }
+
+  cuts.erase(std::remove_if(cuts.begin(), cuts.end(),
+                            [&cut](const Cut &other) {
+                              return cut.dominates(other);
+                            }),
+             cuts.end());
+  cuts.push_back(cut);
+}
+
+void CutsFinder::select(Cuts &cuts) const {
+  for (auto &cut : cuts) {
+    cut.cost = cost(cut);
+  }
+
+  // The order is total, so the result does not depend on the schedule.
+  std::sort(cuts.begin(), cuts.end(), [](const Cut &lhs, const Cut &rhs) {
+    if (lhs.cost != rhs.cost) {
+      return lhs.cost < rhs.cost;
+    }
+    return std::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+  });
+
+  if (cuts.size() > maxCuts) {
+    cuts.resize(maxCuts);
+  }
+}
+
+template <typename FaninCuts>
+void CutsFinder::find(GateID node,
+                      GateSymbol func,
+                      bool terminal,
+                      const std::vector<GateID> &fanins,
+                      FaninCuts faninCuts,
+                      Cuts &result) const {
+  result.clear();
+
+  // Adding trivial cut.
+  result.emplace_back(node);
+  result.back().cost = cost(result.back());
+
+  if (terminal || fanins.empty()) {
+    return;
+  }
+
+  // Merging the fanin cuts one by one keeping the best partial cuts.
+  Cuts partial{Cut()};
+  Cuts next;
+
+  for (std::size_t j = 0; j < fanins.size() && !partial.empty(); j++) {
+    const Cut leaf(fanins[j]);
+    const Cuts *cuts = faninCuts(j);
+
+    const Cut *begin = cuts && !cuts->empty() ? cuts->data() : &leaf;
+    const Cut *end = cuts && !cuts->empty() ? begin + cuts->size() : &leaf + 1;
+
+    next.clear();
+    for (const auto &lhs : partial) {
+      for (const Cut *rhs = begin; rhs != end; rhs++) {
+        Cut merged;
+        if (Cut::merge(lhs, *rhs, cutSize, merged)) {
+          add(next, merged);
+        }
+      }
+    }
+
+    select(next);
+    std::swap(partial, next);
+  }
+
+  TTBuilder::TruthTableList tables(fanins.size());
+
+  for (auto &cut : partial) {
+    if (cut == result.front()) {
+      continue;
+    }
+
+    // Every fanin is covered by a cut that is a subset of the given one.
+    if (cut.size() <= Cut::MAX_TABLE_SIZE) {
+      for (std::size_t j = 0; j < fanins.size(); j++) {
+        const Cut leaf(fanins[j]);
+        const Cuts *cuts = faninCuts(j);
+
+        const Cut *subset = &leaf;
+        if (cuts) {
+          for (const auto &faninCut : *cuts) {
+            if (faninCut.dominates(cut)) {
+              subset = &faninCut;
+              break;
+            }
+          }
+        }
+
+        tables[j] = expand(*subset, cut);
+      }
+
+      cut.table = TTBuilder::applyGateFunc(func, tables);
+    }
+
+    result.push_back(cut);
+  }
+}
+
+void CutsFinder::find(GateID node, CutStorage &storage) const {
+  const auto *gate = Gate::get(node);
+
+  std::vector<GateID> fanins;
+  fanins.reserve(gate->arity());
+  for (const auto &input : gate->inputs()) {
+    fanins.push_back(input.node());
+  }
+
+  const auto terminal = gate->isSource() || gate->isTrigger() ||
+                        !isCombinational(gate->func());
+  auto &result = storage.cuts[node];
+
+  find(node, gate->func(), terminal, fanins,
+       [&storage, &fanins](std::size_t j) {
+    const auto i = storage.cuts.find(fanins[j]);
+    return i != storage.cuts.end() ? &i->second : nullptr;
+  }, result);
+}
+
+void CutsFinder::find(const GNet &net, CutStorage &storage) const {
+  const GArray array(net);
+  const auto n = array.nGates();
+
+  const auto isTerminal = [&array](GArray::Index i) {
+    return array.isSource(i) || array.isTrigger(i) ||
+           !isCombinational(array.func(i));
+  };
+
+  // Computing the topological levels (the terminal nodes break cycles).
+  std::vector<GArray::Index> nDeps(n, 0);
+  std::vector<GArray::Index> level(n, 0);
+  std::vector<GArray::Index> order;
+  order.reserve(n);
+
+  for (GArray::Index i = 0; i < n; i++) {
+    if (!isTerminal(i)) {
+      for (std::size_t j = 0; j < array.arity(i); j++) {
+        nDeps[i] += (array.fanin(i, j) != GArray::EXTERNAL);
+      }
+    }
+    if (nDeps[i] == 0) {
+      order.push_back(i);
+    }
+  }
+
+  for (std::size_t k = 0; k < order.size(); k++) {
+    const auto i = order[k];
+    for (std::size_t j = 0; j < array.fanout(i); j++) {
+      const auto s = array.fanout(i, j);
+      if (isTerminal(s)) {
+        continue;
+      }
+      level[s] = std::max(level[s], level[i] + 1);
+      if (--nDeps[s] == 0) {
+        order.push_back(s);
+      }
+    }
+  }
+
+  // The nodes on combinational cycles (if any) are processed at the end.
+  const auto nLevels = order.empty() ? 0 : level[order.back()] + 1;
+  std::vector<std::vector<GArray::Index>> levels(nLevels + 1);
+
+  for (const auto i : order) {
+    levels[level[i]].push_back(i);
+  }
+  for (GArray::Index i = 0; i < n; i++) {
+    if (nDeps[i] != 0) {
+      levels[nLevels].push_back(i);
+    }
+  }
+
+  // The cuts are stored by indices and moved to the storage afterwards.
+  std::vector<Cuts> cuts(n);
+
+  const auto process = [&](GArray::Index i) {
+    std::vector<GateID> fanins(array.arity(i));
+    for (std::size_t j = 0; j < fanins.size(); j++) {
+      fanins[j] = array.faninId(i, j);
+    }
+
+    find(array.id(i), array.func(i), isTerminal(i), fanins,
+         [&array, &cuts, i](std::size_t j) {
+      const auto k = array.fanin(i, j);
+      return k != GArray::EXTERNAL ? &cuts[k] : nullptr;
+    }, cuts[i]);
+  };
+
+  // The nodes of the same level do not depend on each other: the large
+  // levels are processed by a pool of workers started once per call. The
+  // workers (and the calling thread) claim the nodes of the current level
+  // in chunks; the next level is started when all of them have finished.
+  std::mutex mutex;
+  std::condition_variable started, finished;
+  const std::vector<GArray::Index> *current = nullptr;
+  std::size_t generation = 0;
+  std::size_t pending = 0;
+  bool stop = false;
+  std::atomic<std::size_t> next{0};
+
+  const auto drain = [&](const std::vector<GArray::Index> &nodes) {
+    for (auto begin = next.fetch_add(CHUNK_SIZE); begin < nodes.size();
+         begin = next.fetch_add(CHUNK_SIZE)) {
+      const auto end = std::min(begin + CHUNK_SIZE, nodes.size());
+      for (auto k = begin; k < end; k++) {
+        process(nodes[k]);
+      }
+    }
+  };
+
+  // The workers read the gates from the store of the calling thread.
+  auto &store = Gate::store();
+
+  const auto work = [&]() {
+    GateStore::Scope scope(store);
+
+    for (std::size_t seen = 0;;) {
+      const std::vector<GArray::Index> *nodes;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        started.wait(lock, [&]() { return stop || generation != seen; });
+        if (stop) {
+          return;
+        }
+        seen = generation;
+        nodes = current;
+      }
+
+      drain(*nodes);
+
+      std::lock_guard<std::mutex> lock(mutex);
+      if (--pending == 0) {
+        finished.notify_one();
+      }
+    }
+  };
+
+  // The nodes on cycles depend on each other and are never drained.
+  const bool parallel = nThreads > 1 &&
+      std::any_of(levels.begin(), levels.end() - 1, [](const auto &nodes) {
+        return nodes.size() >= PARALLEL_THRESHOLD;
+      });
+
+  std::vector<std::thread> workers;
+  if (parallel) {
+    workers.reserve(nThreads - 1);
+    for (unsigned k = 1; k < nThreads; k++) {
+      workers.emplace_back(work);
+    }
+  }
+
+  for (std::size_t l = 0; l <= nLevels; l++) {
+    const auto &nodes = levels[l];
+    if (workers.empty() || nodes.size() < PARALLEL_THRESHOLD ||
+        l == nLevels) {
+      for (const auto i : nodes) {
+        process(i);
+      }
+      continue;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      current = &nodes;
+      next = 0;
+      pending = workers.size();
+      generation++;
+    }
+    started.notify_all();
+
+    drain(nodes);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&]() { return pending == 0; });
+  }
+
+  if (!workers.empty()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    started.notify_all();
+
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  storage.cuts.reserve(storage.cuts.size() + n);
+  for (GArray::Index i = 0; i < n; i++) {
+    storage.cuts[array.id(i)] = std::move(cuts[i]);
+  }
+}
+
+} // namespace eda::gate::optimizer
@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "gate/model/gnet.h"
+#include "gate/optimizer/cut_storage.h"
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace eda::gate::optimizer {
+
+/**
+ * \brief Enumerates the priority cuts of the net nodes.
+ *
+ * For each node, the trivial cut and at most maxCuts best non-trivial cuts
+ * (w.r.t. the cost function) are stored; the dominated cuts are dropped.
+ * The truth tables of the small cuts are computed from the fanin cuts' ones.
+ * The nodes of the same topological level are processed in parallel.
+ */
+class CutsFinder final {
+public:
+  using GateSymbol = model::GateSymbol;
+  using GNet = model::GNet;
+  using GateID = GNet::GateId;
+  using Cut = CutStorage::Cut;
+  using Cuts = CutStorage::Cuts;
+
+  /// Cut cost function (the less the better).
+  using CostFunction = std::function<float(const Cut &)>;
+
+  /// Default number of non-trivial cuts per node.
+  static constexpr std::size_t DEFAULT_MAX_CUTS = 16;
+  /// Minimal level size that is processed in parallel.
+  static constexpr std::size_t PARALLEL_THRESHOLD = 256;
+  /// Number of nodes claimed by a worker at once.
+  static constexpr std::size_t CHUNK_SIZE = 32;
+
+  /// Returns the number of leaves.
+  static float leafCost(const Cut &cut) {
+    return static_cast<float>(cut.size());
+  }
+
+  CutsFinder(int cutSize,
+             std::size_t maxCuts = DEFAULT_MAX_CUTS,
+             CostFunction cost = leafCost,
+             unsigned nThreads = 0);
+
+  /// Computes the cuts of all the nodes of the net.
+  void find(const GNet &net, CutStorage &storage) const;
+
+  /// Computes the cuts of the node assuming that the fanin cuts are known
+  /// (a fanin w/o cuts is considered as a leaf).
+  void find(GateID node, CutStorage &storage) const;
+
+private:
+  /// Computes the cuts of a node: faninCuts(j) returns the cuts of the j-th
+  /// fanin (or nullptr if unknown); terminal nodes have only trivial cuts.
+  template <typename FaninCuts>
+  void find(GateID node,
+            GateSymbol func,
+            bool terminal,
+            const std::vector<GateID> &fanins,
+            FaninCuts faninCuts,
+            Cuts &result) const;
+
+  /// Returns the truth table of the cut w.r.t. the leaves of the superset.
+  static uint64_t expand(const Cut &cut, const Cut &superset);
+
+  /// Adds the cut to the list unless it is dominated.
+  static void add(Cuts &cuts, const Cut &cut);
+
+  /// Sorts the cuts by cost and keeps at most maxCuts of them.
+  void select(Cuts &cuts) const;
+
+  const std::size_t cutSize;
+  const std::size_t maxCuts;
+  const CostFunction cost;
+  const unsigned nThreads;
+};
+
+} // namespace eda::gate::optimizer
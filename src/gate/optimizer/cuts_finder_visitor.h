@@ -9,6 +9,7 @@
 #pragma once
 
 #include "gate/optimizer/cut_storage.h"
+#include "gate/optimizer/cuts_finder.h"
 #include "gate/optimizer/visitor.h"
 
 namespace eda::gate::optimizer {
@@ -19,12 +20,14 @@ namespace eda::gate::optimizer {
  */
   class CutsFindVisitor : public Visitor {
 
-    int cutSize;
+    CutsFinder finder;
     CutStorage *cutStorage;
 
   public:
 
-    CutsFindVisitor(int cutSize, CutStorage *cutStorage);
+    CutsFindVisitor(int cutSize, CutStorage *cutStorage,
+                    size_t maxCuts = CutsFinder::DEFAULT_MAX_CUTS,
+                    CutsFinder::CostFunction cost = CutsFinder::leafCost);
 
     VisitorFlags onNodeBegin(const GateID &) override;
 
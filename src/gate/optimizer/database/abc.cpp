@@ -8,9 +8,9 @@
 
 #include "gate/model/gnet.h"
 #include "gate/model/utils.h"
+#include "gate/optimizer/npn.h"
 #include "gate/optimizer/rwdatabase.h"
 #include "gate/optimizer/ttbuilder.h"
-#include "util/math.h"
 
 #include <algorithm>
 #include <cstdlib>
@@ -120,92 +120,20 @@ static BoundGNet getCircuit(GateId gid, const BoundGNet &bnet) {
   return BoundGNet{circuit, bindings};
 }
 
-static BoundGNet clone(const BoundGNet &circuit) {
-  BoundGNet newCircuit;
-
-  GateIdMap oldToNewGates;
-  newCircuit.net = std::shared_ptr<GNet>(circuit.net->clone(oldToNewGates));
-
-  for (const auto &[inputId, oldGateId] : circuit.bindings) {
-    const auto newGateId = oldToNewGates[oldGateId];
-    assert(newGateId != 0);
-
-    newCircuit.bindings[inputId] = newGateId;
-  }
-
-  return newCircuit;
-}
-
-static void generateNpnInstances(const BoundGNet &bnet, RWDatabase &database) {
-  static size_t perm[24][4] = {
-    {0, 1, 2, 3},
-    {1, 0, 2, 3},
-    {2, 0, 1, 3},
-    {0, 2, 1, 3},
-    {1, 2, 0, 3},
-    {2, 1, 0, 3},
-    {2, 1, 3, 0},
-    {1, 2, 3, 0},
-    {3, 2, 1, 0},
-    {2, 3, 1, 0},
-    {1, 3, 2, 0},
-    {3, 1, 2, 0},
-    {3, 0, 2, 1},
-    {0, 3, 2, 1},
-    {2, 3, 0, 1},
-    {3, 2, 0, 1},
-    {0, 2, 3, 1},
-    {2, 0, 3, 1},
-    {1, 0, 3, 2},
-    {0, 1, 3, 2},
-    {3, 1, 0, 2},
-    {1, 3, 0, 2},
-    {0, 3, 1, 2},
-    {3, 0, 1, 2}
-  };
-
+/// Stores the circuit in the canonical form of its NPN class.
+static void addNpnClass(const BoundGNet &bnet, RWDatabase &database) {
   const size_t k = bnet.bindings.size();
-  const size_t N = 1 << (k + 1);
-  const size_t P = utils::factorial(k);
-
-  for (unsigned n = 0; n < N; n++) {
-    // Clone the net consistently w/ the bindings.
-    auto circuit = clone(bnet);
-
-    // Negate the inputs.
-    for (unsigned i = 0; i < k; i++) {
-      if ((n >> i) & 1) {
-        auto oldInputId = circuit.bindings[i];
-        auto newInputId = circuit.net->addIn();
-        circuit.net->setNot(oldInputId, newInputId);
-        circuit.bindings[i] = newInputId;
-      }
-    }
-
-    // Negate the output.
-    if ((n >> k) & 1) {
-      auto oldOutputId = circuit.net->targetLinks().begin()->source;
-      auto *gate = Gate::get(oldOutputId);
-      circuit.net->setNot(oldOutputId, gate->input(0));
-      circuit.net->addOut(oldOutputId);
-    }
+  const auto truthTable = TTBuilder::build(bnet);
+  const auto [canonTable, transform] = NpnCanonizer::canonize(truthTable, k);
 
-    // Permute the inputs.
-    for (unsigned p = 0; p < P; p++) {
-      for (unsigned i = 0; i < k; i++) {
-        const auto j = perm[p][i];
-
-        if (i < j) {
-          const auto tempGate = circuit.bindings[i];
-          circuit.bindings[i] = circuit.bindings[j];
-          circuit.bindings[j] = tempGate;
-        }
-      }
-
-      const auto truthTable = TTBuilder::build(circuit);
-      database.set(truthTable, {circuit} /* One circuit per truth table */);
-    }
+  // Circuits w/ redundant inputs are not used for rewriting.
+  if (transform.arity != k) {
+    return;
   }
+
+  auto list = database.get(canonTable);
+  list.push_back(NpnCanonizer::canonicalize(bnet, transform));
+  database.set(canonTable, list);
 }
 
 void initializeAbcRwDatabase(RWDatabase &database) {
@@ -229,7 +157,7 @@ void initializeAbcRwDatabase(RWDatabase &database) {
     if (practicalNpnClasses.find(truthTable) != practicalNpnClasses.end() &&
         processedNpnClasses.find(truthTable) == processedNpnClasses.end()) {
       auto circuit = getCircuit(gid, net);
-      generateNpnInstances(circuit, database);
+      addNpnClass(circuit, database);
 
       // ABC truth tables are used only for filtering.
       processedNpnClasses.emplace(truthTable);
@@ -22,7 +22,6 @@ namespace eda::gate::optimizer {
       auto found = map.find(id);
       if (found != map.end()) {
         substitute[id] = found->second;
-        used.emplace(found->second);
       } else {
         // TODO: implement strategy here.
         substitute[id] = Gate::INVALID;
@@ -46,8 +45,11 @@ namespace eda::gate::optimizer {
       }
       const auto *subGate = net->gate(gate->func(), signals);
       if (subGate) {
-        used.emplace(subGate->id());
         substitute[id] = subGate->id();
+        // The gate of the dereferenced MFFC is kept (it is not removed).
+        if (net->getRefs(subGate->id()) == 0) {
+          ++added;
+        }
       } else {
         ++added;
       }
@@ -25,8 +25,6 @@ namespace eda::gate::optimizer {
 
     VisitorFlags onCut(const Cut &) override;
 
-    const std::unordered_set<GateID> *getUsed() { return &used; };
-
     int getNAdded() const { return added; };
 
     bool checkOutGate(const Gate *gate) const;
@@ -35,7 +33,6 @@ namespace eda::gate::optimizer {
     GNet *net;
     const std::unordered_map<GateID, GateID> &map;
     std::unordered_map<GateID, GateID> substitute;
-    std::unordered_set<GateID> used;
     int added = 0;
   };
 } // namespace eda::gate::optimizer
@@ -10,41 +10,33 @@
 
 namespace eda::gate::optimizer {
 
-  LinkCleanVisitor::LinkCleanVisitor(GateID node, GNet *gNet,
-                                     const std::vector<eda::base::model::Signal<GNet::GateId>> &newSignals)
-          : node(node), newSignals(newSignals),
-            gNet(gNet) {}
-
-  VisitorFlags LinkCleanVisitor::onNodeBegin(const GateID &node) {
-    if (this->node == node) {
-        gNet->setGate(node, Gate::get(node)->func(), newSignals);
-      }  else if (Gate::get(node)->fanout() == 0) {
-      gNet->eraseGate(node);
+  using Gate = model::Gate;
+  using GateId = model::GNet::GateId;
+
+  void cleanLinks(GateId node, model::GNet *net,
+                  const model::GNet::SignalList &newSignals) {
+    std::vector<GateId> stack;
+    for (const auto &input : Gate::get(node)->inputs()) {
+      stack.push_back(input.node());
     }
-    /*
-     * else {
-        Gate *oldGate = Gate::get(oldOut);
-        Gate *newGate = Gate::get(newOut);
-        // Removing links from outputs of oldGate and
-        // connecting links of old gate to the new gate.
-        for(const auto & out : oldGate->links()) {
-          Gate *outGate = Gate::get(out.target);
-          auto inputs = outGate->inputs();
-          auto it = std::find(inputs.begin(), inputs.end(), oldOut);
-          *it = newOut;
-          gNet->setGate(out.target, outGate->func(), inputs);
-        }
+
+    net->setGate(node, Gate::get(node)->func(), newSignals);
+
+    // A gate may be pushed several times (once per lost fanout).
+    while (!stack.empty()) {
+      const auto gid = stack.back();
+      stack.pop_back();
+
+      const auto *gate = Gate::get(gid);
+      if (gate->fanout() != 0 || !net->contains(gid)) {
+        continue;
       }
-    }
-     */
-    return SUCCESS;
-  }
 
-  VisitorFlags LinkCleanVisitor::onNodeEnd(const GateID &) {
-    return SUCCESS;
+      for (const auto &input : gate->inputs()) {
+        stack.push_back(input.node());
+      }
+      net->eraseGate(gid);
+    }
   }
 
-  VisitorFlags LinkCleanVisitor::onCut(const Cut &) {
-    return SUCCESS;
-  }
 } // namespace eda::gate::optimizer
@@ -11,31 +11,18 @@
 #include "gate/model/gnet.h"
 #include "gate/optimizer/visitor.h"
 
-namespace eda::gate::optimizer {
-/**
- * \brief Realization of interface Visitor.
- * Removes all gates that get zero fanout after removing links from given node.
- * \author <a href="mailto:dreamer_1977@ispras.ru">Liza Shcherbakova</a>
- */
-  class LinkCleanVisitor : public Visitor {
-
-  public:
-    using Gate = eda::gate::model::Gate;
-    using GateSymbol = eda::gate::model::GateSymbol;
-    using Signal = base::model::Signal<GNet::GateId>;
-
-    LinkCleanVisitor(GateID node, GNet *gNet,
-                     const std::vector<Signal> &newSignals);
+#include <vector>
 
-    VisitorFlags onNodeBegin(const GateID &) override;
-
-    VisitorFlags onNodeEnd(const GateID &) override;
-
-    VisitorFlags onCut(const Cut &) override;
+namespace eda::gate::optimizer {
 
-  private:
-    GateID node;
-    const std::vector<Signal> &newSignals;
-    GNet *gNet;
-  };
-} // namespace eda::gate::optimizer
\ No newline at end of file
+  /**
+   * \brief Replaces the inputs of the node and removes all the gates that
+   * get zero fanout after removing the node's old links.
+   *
+   * Only the gates that lose a fanout are visited, so the cost is bounded
+   * by the size of the removed cone (not of the node's fanin cone).
+   */
+  void cleanLinks(model::GNet::GateId node, model::GNet *net,
+                  const model::GNet::SignalList &newSignals);
+
+} // namespace eda::gate::optimizer
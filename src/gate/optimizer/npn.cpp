@@ -0,0 +1,378 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/optimizer/npn.h"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace eda::gate::optimizer {
+
+using Gate = model::Gate;
+using GateSymbol = model::GateSymbol;
+using GNet = model::GNet;
+using BoundGNet = NpnCanonizer::BoundGNet;
+using InputId = RWDatabase::InputId;
+using TruthTable = NpnCanonizer::TruthTable;
+
+/// Truth tables of the variables.
+static constexpr TruthTable VAR[NpnTransform::MAX_VARS] = {
+  0xaaaaaaaaaaaaaaaaull,
+  0xccccccccccccccccull,
+  0xf0f0f0f0f0f0f0f0ull,
+  0xff00ff00ff00ff00ull,
+  0xffff0000ffff0000ull,
+  0xffffffff00000000ull
+};
+
+/// Returns the Steinhaus-Johnson-Trotter sequence of adjacent swaps that
+/// enumerates all permutations of n elements and returns to the identity.
+static std::vector<uint8_t> getSwaps(std::size_t n) {
+  std::vector<uint8_t> swaps;
+  if (n < 2) {
+    return swaps;
+  }
+
+  std::vector<std::size_t> perm(n);
+  std::vector<int> dir(n, -1);
+  for (std::size_t i = 0; i < n; i++) {
+    perm[i] = i;
+  }
+
+  while (true) {
+    // Find the largest mobile element.
+    std::size_t pos = n;
+    for (std::size_t i = 0; i < n; i++) {
+      const auto j = static_cast<std::ptrdiff_t>(i) + dir[perm[i]];
+      if (j >= 0 && j < static_cast<std::ptrdiff_t>(n) &&
+          perm[j] < perm[i] && (pos == n || perm[i] > perm[pos])) {
+        pos = i;
+      }
+    }
+
+    if (pos == n) {
+      break;
+    }
+
+    const auto element = perm[pos];
+    const auto next = pos + dir[element];
+
+    swaps.push_back(std::min(pos, next));
+    std::swap(perm[pos], perm[next]);
+
+    for (std::size_t e = element + 1; e < n; e++) {
+      dir[e] = -dir[e];
+    }
+  }
+
+  // The last permutation differs from the identity in the first two places.
+  assert(perm[0] == 1 && perm[1] == 0);
+  swaps.push_back(0);
+
+  return swaps;
+}
+
+/// Swaps the i-th and (i+1)-th variables of g in the transform.
+static void swapVars(NpnTransform &transform, std::size_t i) {
+  std::swap(transform.perm[i], transform.perm[i + 1]);
+
+  const unsigned bits = (transform.negInputs >> i) & 3;
+  if (bits == 1 || bits == 2) {
+    transform.negInputs ^= (3 << i);
+  }
+}
+
+bool NpnCanonizer::dependsOn(TruthTable func, std::size_t i) {
+  assert(i < NpnTransform::MAX_VARS);
+  return ((func >> (1u << i)) & ~VAR[i]) != (func & ~VAR[i]);
+}
+
+TruthTable NpnCanonizer::flip(TruthTable func, std::size_t i) {
+  assert(i < NpnTransform::MAX_VARS);
+  const auto shift = 1u << i;
+  return ((func & VAR[i]) >> shift) | ((func & ~VAR[i]) << shift);
+}
+
+TruthTable NpnCanonizer::swap(TruthTable func, std::size_t i) {
+  assert(i + 1 < NpnTransform::MAX_VARS);
+  const auto shift = 1u << i;
+  const auto up = VAR[i] & ~VAR[i + 1];
+  const auto down = ~VAR[i] & VAR[i + 1];
+  return (func & ~(up | down)) | ((func & up) << shift)
+                               | ((func & down) >> shift);
+}
+
+std::pair<TruthTable, NpnTransform>
+NpnCanonizer::canonizeExact(TruthTable func, std::size_t k) {
+  static const std::vector<uint8_t> swaps[] = {
+    getSwaps(0), getSwaps(1), getSwaps(2), getSwaps(3),
+    getSwaps(4), getSwaps(5), getSwaps(6)
+  };
+
+  assert(k <= NpnTransform::MAX_VARS);
+
+  // Move the essential variables to the lowest positions.
+  NpnTransform current;
+  std::size_t n = 0;
+  for (std::size_t i = 0; i < k; i++) {
+    if (dependsOn(func, i)) {
+      for (std::size_t j = i; j > n; j--) {
+        func = swap(func, j - 1);
+        swapVars(current, j - 1);
+      }
+      n++;
+    }
+  }
+  current.arity = n;
+
+  TruthTable best = func;
+  NpnTransform bestTransform = current;
+
+  const auto update = [&](TruthTable g) {
+    if (g < best) {
+      best = g;
+      bestTransform = current;
+      bestTransform.negOutput = false;
+    }
+    if (~g < best) {
+      best = ~g;
+      bestTransform = current;
+      bestTransform.negOutput = true;
+    }
+  };
+
+  update(func);
+
+  // Gray code for the input negations and SJT for the permutations.
+  const std::size_t nFlips = 1u << n;
+  for (std::size_t i = 0; i < nFlips; i++) {
+    for (const auto j : swaps[n]) {
+      func = swap(func, j);
+      swapVars(current, j);
+      update(func);
+    }
+
+    if (i + 1 < nFlips) {
+      const auto j = __builtin_ctzll(i + 1);
+      func = flip(func, j);
+      current.negInputs ^= (1u << j);
+      update(func);
+    }
+  }
+
+  return {best, bestTransform};
+}
+
+std::pair<TruthTable, NpnTransform> NpnCanonizer::canonize(TruthTable func,
+                                                           std::size_t k) {
+  using Memo = std::unordered_map<TruthTable, std::pair<TruthTable,
+                                                        NpnTransform>>;
+
+  assert(k <= NpnTransform::MAX_VARS);
+  if (k < MEMO_VARS) {
+    return canonizeExact(func, k);
+  }
+
+  // The canonizer is called from the rewriting workers.
+  thread_local Memo memo[NpnTransform::MAX_VARS + 1];
+
+  auto &cache = memo[k];
+  const auto i = cache.find(func);
+  if (i != cache.end()) {
+    return i->second;
+  }
+
+  if (cache.size() >= MEMO_SIZE) {
+    cache.clear();
+  }
+
+  return cache.emplace(func, canonizeExact(func, k)).first->second;
+}
+
+TruthTable NpnCanonizer::apply(TruthTable func,
+                               std::size_t k,
+                               const NpnTransform &transform) {
+  assert(k <= NpnTransform::MAX_VARS);
+
+  // The variables x[arity], ..., x[5] are ignored (the result is replicated).
+  TruthTable result = 0;
+  for (std::size_t x = 0; x < 64; x++) {
+    std::size_t y = 0;
+    for (std::size_t i = 0; i < transform.arity; i++) {
+      const auto bit = ((x >> i) & 1) ^ transform.isNegated(i);
+      y |= bit << transform.perm[i];
+    }
+
+    const auto value = ((func >> y) & 1) ^ transform.negOutput;
+    result |= static_cast<TruthTable>(value) << x;
+  }
+
+  return result;
+}
+
+/// Rebuilds the net negating/renaming the inputs and negating the output:
+/// the input w/ the binding i gets the binding index[i] (if it exists).
+/// The inverters are propagated through the NOT gates, so that the result
+/// does not contain double negations.
+static BoundGNet rebuild(const BoundGNet &bnet,
+                         const std::unordered_map<InputId, InputId> &index,
+                         const std::unordered_map<InputId, bool> &negInputs,
+                         bool negOutput) {
+  // Literal is a gate of the new net w/ the negation flag.
+  using Literal = std::pair<Gate::Id, bool>;
+
+  if (!bnet.net->isSorted()) {
+    bnet.net->sortTopologically();
+  }
+
+  std::unordered_map<Gate::Id, InputId> sources;
+  for (const auto &[i, gid] : bnet.bindings) {
+    sources.emplace(gid, i);
+  }
+
+  BoundGNet result;
+  result.net = std::make_shared<GNet>();
+  auto &net = *result.net;
+
+  std::unordered_map<Gate::Id, Literal> literals;
+  std::unordered_map<Gate::Id, Gate::Id> inverters;
+
+  const auto getGate = [&](const Literal &literal) {
+    const auto [gid, negated] = literal;
+    if (!negated) {
+      return gid;
+    }
+    const auto i = inverters.find(gid);
+    if (i != inverters.end()) {
+      return i->second;
+    }
+    return inverters[gid] = net.addNot(gid);
+  };
+
+  for (const auto *gate : bnet.net->gates()) {
+    const auto gid = gate->id();
+
+    if (gate->isSource()) {
+      const auto newGateId = net.addIn();
+      const auto i = sources.find(gid);
+
+      bool negated = false;
+      if (i != sources.end()) {
+        const auto j = index.find(i->second);
+        if (j != index.end()) {
+          result.bindings[j->second] = newGateId;
+        }
+        const auto k = negInputs.find(i->second);
+        negated = (k != negInputs.end() && k->second);
+      }
+
+      literals[gid] = {newGateId, negated};
+    } else if (gate->isTarget()) {
+      auto literal = literals.at(gate->input(0).node());
+      literal.second ^= negOutput;
+      net.addOut(getGate(literal));
+    } else if (gate->func() == GateSymbol::NOT) {
+      auto literal = literals.at(gate->input(0).node());
+      literal.second = !literal.second;
+      literals[gid] = literal;
+    } else {
+      Gate::SignalList inputs;
+      inputs.reserve(gate->arity());
+      for (const auto &input : gate->inputs()) {
+        inputs.push_back(Gate::Signal::always(
+            getGate(literals.at(input.node()))));
+      }
+      literals[gid] = {net.addGate(gate->func(), inputs), false};
+    }
+  }
+
+  return result;
+}
+
+BoundGNet NpnCanonizer::instantiate(const BoundGNet &canonical,
+                                    const NpnTransform &transform) {
+  std::unordered_map<InputId, InputId> index;
+  std::unordered_map<InputId, bool> negInputs;
+
+  for (InputId i = 0; i < transform.arity; i++) {
+    index[i] = transform.perm[i];
+    negInputs[i] = transform.isNegated(i);
+  }
+
+  return rebuild(canonical, index, negInputs, transform.negOutput);
+}
+
+namespace {
+
+/// Instances of the canonical nets (see NpnCanonizer::getInstance()).
+struct InstanceCache final {
+  using Key = std::pair<const GNet*, uint32_t>;
+
+  struct KeyHash final {
+    std::size_t operator()(const Key &key) const {
+      return std::hash<const GNet*>()(key.first) ^
+             (static_cast<std::size_t>(key.second) * 0x9e3779b97f4a7c15ull);
+    }
+  };
+
+  struct Entry final {
+    /// Keeps the canonical net alive (its address is a part of the key).
+    std::shared_ptr<GNet> canonical;
+    BoundGNet instance;
+  };
+
+  std::unordered_map<Key, Entry, KeyHash> entries;
+};
+
+} // namespace
+
+/// Packs the transform into an integer.
+static uint32_t pack(const NpnTransform &transform) {
+  uint32_t key = transform.arity
+               | (static_cast<uint32_t>(transform.negInputs) << 3)
+               | (static_cast<uint32_t>(transform.negOutput) << 9);
+  for (std::size_t i = 0; i < NpnTransform::MAX_VARS; i++) {
+    key |= static_cast<uint32_t>(transform.perm[i]) << (10 + 3 * i);
+  }
+  return key;
+}
+
+const BoundGNet &NpnCanonizer::getInstance(const BoundGNet &canonical,
+                                           const NpnTransform &transform) {
+  // The instances are built of the gates of the current store.
+  auto &cache = Gate::store().local<InstanceCache>();
+
+  const InstanceCache::Key key{canonical.net.get(), pack(transform)};
+  const auto i = cache.entries.find(key);
+  if (i != cache.entries.end()) {
+    return i->second.instance;
+  }
+
+  auto &entry = cache.entries[key];
+  entry.canonical = canonical.net;
+  entry.instance = instantiate(canonical, transform);
+  return entry.instance;
+}
+
+BoundGNet NpnCanonizer::canonicalize(const BoundGNet &bnet,
+                                     const NpnTransform &transform) {
+  std::unordered_map<InputId, InputId> index;
+  std::unordered_map<InputId, bool> negInputs;
+
+  for (InputId i = 0; i < transform.arity; i++) {
+    index[transform.perm[i]] = i;
+    negInputs[transform.perm[i]] = transform.isNegated(i);
+  }
+
+  return rebuild(bnet, index, negInputs, transform.negOutput);
+}
+
+} // namespace eda::gate::optimizer
@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "gate/optimizer/rwdatabase.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace eda::gate::optimizer {
+
+/**
+ * \brief NPN transform of a boolean function of at most 6 variables.
+ *
+ * The transform maps a function f to the function g such that
+ * g(x[0], ..., x[arity-1]) = negOutput ^ f(y), where
+ * y[perm[i]] = x[i] ^ negInputs[i] and f does not depend on the other y's.
+ */
+struct NpnTransform final {
+  using InputId = RWDatabase::InputId;
+
+  /// Maximum number of variables.
+  static constexpr std::size_t MAX_VARS = 6;
+
+  /// Checks whether the i-th input is negated.
+  bool isNegated(std::size_t i) const { return (negInputs >> i) & 1; }
+
+  /// Number of variables of g (the support size of f).
+  uint8_t arity = 0;
+  /// Variables of f corresponding to the variables of g.
+  uint8_t perm[MAX_VARS] = {0, 1, 2, 3, 4, 5};
+  /// Input negation mask (w.r.t. the variables of g).
+  uint8_t negInputs = 0;
+  /// Output negation flag.
+  bool negOutput = false;
+};
+
+/**
+ * \brief Exact NPN canonizer for the 64-bit truth tables.
+ *
+ * The truth tables are represented as in TTBuilder: a function of k < 6
+ * variables is replicated 2^(6-k) times. The canonical form is the minimal
+ * truth table among the NPN-equivalent functions of the support size.
+ * The exhaustive search over the 2^k * k! transforms is memoized per truth
+ * table (in a bounded per-thread cache) for k >= MEMO_VARS.
+ */
+class NpnCanonizer final {
+public:
+  using BoundGNet = RWDatabase::BoundGNet;
+  using TruthTable = RWDatabase::TruthTable;
+
+  /// Minimal number of variables whose canonical forms are memoized.
+  static constexpr std::size_t MEMO_VARS = 4;
+  /// Maximal number of memoized canonical forms per thread.
+  static constexpr std::size_t MEMO_SIZE = 1u << 16;
+
+  /// Returns the canonical form of the k-variable function and
+  /// the transform that maps the function to the canonical form.
+  static std::pair<TruthTable, NpnTransform> canonize(TruthTable func,
+                                                      std::size_t k);
+
+  /// Finds the canonical form by the exhaustive search (not memoized).
+  static std::pair<TruthTable, NpnTransform> canonizeExact(TruthTable func,
+                                                           std::size_t k);
+
+  /// Applies the transform to the k-variable function.
+  static TruthTable apply(TruthTable func,
+                          std::size_t k,
+                          const NpnTransform &transform);
+
+  /// Builds the net implementing f from the net implementing the canonical
+  /// form g: the i-th input of the given net is bound to y[perm[i]].
+  static BoundGNet instantiate(const BoundGNet &canonical,
+                               const NpnTransform &transform);
+
+  /// Returns the instance of the canonical net for the transform (see
+  /// instantiate()). The instances are cached in the current gate store per
+  /// (canonical net, transform): the repeated matches of the same class do
+  /// not create new gates. The instances must not be modified.
+  static const BoundGNet &getInstance(const BoundGNet &canonical,
+                                      const NpnTransform &transform);
+
+  /// Builds the net implementing the canonical form g from the net
+  /// implementing f (the inverse of instantiate).
+  static BoundGNet canonicalize(const BoundGNet &bnet,
+                                const NpnTransform &transform);
+
+  /// Checks whether the function depends on the i-th variable.
+  static bool dependsOn(TruthTable func, std::size_t i);
+
+  /// Negates the i-th variable of the function.
+  static TruthTable flip(TruthTable func, std::size_t i);
+
+  /// Swaps the i-th and (i+1)-th variables of the function.
+  static TruthTable swap(TruthTable func, std::size_t i);
+};
+
+} // namespace eda::gate::optimizer
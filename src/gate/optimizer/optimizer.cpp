@@ -10,42 +10,110 @@
 
 namespace eda::gate::optimizer {
 
-  void optimize(GNet *net, int cutSize, OptimizerVisitor &&optimizer) {
-    CutStorage cutStorage = findCuts(cutSize, net);
+  using Clock = OptimizerVisitor::Clock;
+
+  size_t invalidateCuts(const GNet &net,
+                        const std::vector<GateID> &replaced,
+                        CutStorage &cutStorage) {
+    size_t count = 0;
+
+    std::vector<GateID> stack(replaced);
+    while (!stack.empty()) {
+      const auto node = stack.back();
+      stack.pop_back();
+
+      // The node w/o cuts is either invalidated or new.
+      if (cutStorage.cuts.erase(node) == 0 || !net.contains(node)) {
+        continue;
+      }
+
+      count++;
+      for (const auto &link : Gate::get(node)->links()) {
+        if (net.contains(link.target)) {
+          stack.push_back(link.target);
+        }
+      }
+    }
 
-    std::cout << "cuts found" << std::endl;
+    return count;
+  }
 
-    optimizer.set(&cutStorage, net, cutSize);
-    Walker walker(net, &optimizer, &cutStorage);
+  /// Runs the rewriting passes: the optimizer is driven by the visitor.
+  static RewriteStats rewrite(GNet *net, CutStorage &cutStorage,
+                              OptimizerVisitor &optimizer, Visitor &visitor,
+                              const RewriteParams &params) {
+    const auto start = Clock::now();
+    const bool limited = params.timeBudget.count() > 0;
+    if (limited) {
+      optimizer.setDeadline(start + params.timeBudget);
+    }
 
-    // TODO: change for normal condition.
-    while (true) {
+    RewriteStats stats;
+    size_t nRecut = 0;
+
+    for (size_t i = 0; i < params.maxPasses; i++) {
+      const auto passStart = Clock::now();
+      const auto nGates = net->nGates();
+
+      OptimizerVisitor::Journal journal;
+      optimizer.setJournal(&journal);
+      optimizer.startPass();
+
+      Walker walker(net, &visitor, &cutStorage);
       walker.walk(true);
-      break;
+
+      optimizer.setJournal(nullptr);
+
+      RewriteStats::Pass pass;
+      pass.nCandidates = journal.nCandidates;
+      pass.nApplied = journal.nApplied;
+      pass.nSaved = static_cast<long>(nGates) -
+                    static_cast<long>(net->nGates());
+      pass.nRecut = nRecut;
+      pass.time = std::chrono::duration_cast<std::chrono::microseconds>(
+          Clock::now() - passStart);
+      stats.passes.push_back(pass);
+
+      if (pass.nApplied == 0 ||
+          pass.nSaved < params.minGain * nGates ||
+          (limited && Clock::now() - start >= params.timeBudget)) {
+        break;
+      }
+
+      nRecut = invalidateCuts(*net, journal.replaced, cutStorage);
     }
+
+    optimizer.setDeadline(Clock::time_point::max());
+    return stats;
+  }
+
+  RewriteStats optimize(GNet *net, int cutSize, OptimizerVisitor &&optimizer,
+                        const RewriteParams &params) {
+    CutStorage cutStorage = findCuts(cutSize, net);
+
+    std::cout << "cuts found" << std::endl;
+
+    optimizer.set(&cutStorage, net, cutSize);
+    return rewrite(net, cutStorage, optimizer, optimizer, params);
   }
 
-  void
+  RewriteStats
   optimizePrint(GNet *net, int cutSize, const std::filesystem::path &subCatalog,
-                OptimizerVisitor &&optimizer) {
+                OptimizerVisitor &&optimizer, const RewriteParams &params) {
     CutStorage cutStorage = findCuts(cutSize, net);
 
     std::cout << "cuts found " << std::endl;
 
     optimizer.set(&cutStorage, net, cutSize);
     TrackerVisitor trackerVisitor(subCatalog, net, &optimizer);
-    Walker walker(net, &trackerVisitor, &cutStorage);
-
-    // TODO: change for normal condition.
-    while (true) {
-      walker.walk(true);
-      break;
-    }
+    return rewrite(net, cutStorage, optimizer, trackerVisitor, params);
   }
 
-  void optimizeTrackPrint(GNet *net, int cutSize,
-                          const std::filesystem::path &subCatalog,
-                          OptimizerVisitor &&optimizer) {
+  RewriteStats
+  optimizeTrackPrint(GNet *net, int cutSize,
+                     const std::filesystem::path &subCatalog,
+                     OptimizerVisitor &&optimizer,
+                     const RewriteParams &params) {
     CutStorage cutStorage = findCuts(cutSize, net);
 
     std::cout << "cuts found " << std::endl;
@@ -55,22 +123,15 @@ namespace eda::gate::optimizer {
     trackStrategy.set(&cutStorage, net, cutSize);
 
     TrackerVisitor trackerVisitor(subCatalog, net, &trackStrategy);
-    Walker walker(net, &trackerVisitor, &cutStorage);
-
-    // TODO: change for normal condition.
-    while (true) {
-      walker.walk(true);
-      break;
-    }
+    return rewrite(net, cutStorage, trackStrategy, trackerVisitor, params);
   }
 
-  CutStorage findCuts(int cutSize, GNet *net) {
+  CutStorage findCuts(int cutSize, GNet *net, size_t maxCuts,
+                      CutsFinder::CostFunction cost) {
     CutStorage cutStorage;
 
-    CutsFindVisitor visitor(cutSize, &cutStorage);
-    Walker firstFind(net, &visitor, &cutStorage);
-    // Find cuts on the first iteration.
-    firstFind.walk(true);
+    CutsFinder finder(cutSize, maxCuts, cost);
+    finder.find(*net, cutStorage);
 
     return cutStorage;
   }
@@ -15,24 +15,84 @@
 #include "gate/optimizer/tracker_visitor.h"
 #include "gate/optimizer/walker.h"
 
+#include <chrono>
 #include <queue>
+#include <vector>
 
 namespace eda::gate::optimizer {
 
   using GNet = eda::gate::model::GNet;
   using GateID = eda::gate::model::GNet::GateId;
   using Gate = eda::gate::model::Gate;
-  using Cut = std::unordered_set<GateID>;
+  using Cut = CutStorage::Cut;
 
-  void optimize(GNet *net, int cutSize, OptimizerVisitor &&optimizer);
+  /// Parameters of the rewriting driver.
+  struct RewriteParams {
+    /// Maximum number of the rewriting passes.
+    size_t maxPasses = 8;
+    /// Minimum gain of a pass (the ratio of the saved gates to the net size)
+    /// that is required to run the next pass.
+    double minGain = 0.01;
+    /// Wall-clock time budget (zero stands for no limit).
+    std::chrono::milliseconds timeBudget{0};
+  };
 
-  void
+  /// Statistics of the rewriting passes.
+  struct RewriteStats {
+    struct Pass {
+      /// Number of the evaluated replacement candidates.
+      size_t nCandidates = 0;
+      /// Number of the applied replacements.
+      size_t nApplied = 0;
+      /// Number of the saved gates (negative if the net has grown).
+      long nSaved = 0;
+      /// Number of the nodes whose cuts have been recomputed.
+      size_t nRecut = 0;
+      /// Duration of the pass.
+      std::chrono::microseconds time{0};
+      /// Duration of the concurrent part of the pass (included in time;
+      /// ParallelEvalRewriter only).
+      std::chrono::microseconds parallelTime{0};
+    };
+
+    /// Returns the total number of the saved gates.
+    long nSaved() const {
+      long nSaved = 0;
+      for (const auto &pass : passes) {
+        nSaved += pass.nSaved;
+      }
+      return nSaved;
+    }
+
+    std::vector<Pass> passes;
+  };
+
+  /// Rewrites the net pass by pass until the gain of a pass falls below
+  /// the threshold, the pass limit is hit, or the time budget expires.
+  /// The cuts are recomputed only for the nodes touched by the previous pass.
+  RewriteStats optimize(GNet *net, int cutSize, OptimizerVisitor &&optimizer,
+                        const RewriteParams &params = RewriteParams());
+
+  /// Does the same as optimize() and prints the net after each node.
+  RewriteStats
   optimizePrint(GNet *net, int cutSize, const std::filesystem::path &subCatalog,
-                OptimizerVisitor &&optimizer);
+                OptimizerVisitor &&optimizer,
+                const RewriteParams &params = RewriteParams());
+
+  /// Does the same as optimizePrint() and prints the candidates as well.
+  RewriteStats
+  optimizeTrackPrint(GNet *net, int cutSize,
+                     const std::filesystem::path &subCatalog,
+                     OptimizerVisitor &&optimizer,
+                     const RewriteParams &params = RewriteParams());
 
-  void optimizeTrackPrint(GNet *net, int cutSize,
-                          const std::filesystem::path &subCatalog,
-                          OptimizerVisitor &&optimizer);
+  /// Erases the cuts of the replaced nodes and their transitive fanouts
+  /// (the cuts are recomputed on demand); returns the number of the nodes.
+  size_t invalidateCuts(const GNet &net,
+                        const std::vector<GateID> &replaced,
+                        CutStorage &cutStorage);
 
-  CutStorage findCuts(int cutSize, GNet *net);
+  CutStorage findCuts(int cutSize, GNet *net,
+                      size_t maxCuts = CutsFinder::DEFAULT_MAX_CUTS,
+                      CutsFinder::CostFunction cost = CutsFinder::leafCost);
 } // namespace eda::gate::optimizer
@@ -23,6 +23,13 @@ namespace eda::gate::optimizer {
   }
 
   VisitorFlags OptimizerVisitor::onNodeBegin(const GateID &node) {
+    if (deadline != Clock::time_point::max() && Clock::now() >= deadline) {
+      return FINISH_ALL;
+    }
+    // The node may have been removed by a replacement.
+    if (!net->contains(node)) {
+      return FINISH_THIS;
+    }
     if (cutStorage->cuts.find(node) == cutStorage->cuts.end()) {
       // If node is not in cutStorage - means, that it is a new node.
       // So we recount cuts for that node.
@@ -37,40 +44,28 @@ namespace eda::gate::optimizer {
   VisitorFlags OptimizerVisitor::onCut(const Cut &cut) {
     if (checkValidCut(cut)) {
 
-      // Finding cone.
-      ConeVisitor coneVisitor(cut);
-      Walker walker(net, &coneVisitor, nullptr);
-      walker.walk(lastNode, cut, false);
-
-      // Make binding.
-      RWDatabase::BoundGNet boundGNet;
-      boundGNet.net = std::shared_ptr<GNet>(coneVisitor.getGNet());
-
-      if(coneVisitor.getResultCut().size() > 6) {
+      if (cut.size() > NpnTransform::MAX_VARS) {
         return SUCCESS;
       }
 
-      const auto & cutConeMap = coneVisitor.getResultCut();
-      for(const auto &[gateSource, gateCone] : cutConeMap) {
-        boundGNet.bindings[boundGNet.bindings.size()] = gateCone;
-      }
-
-      auto func = TTBuilder::build(boundGNet);
+      // The database stores the canonical forms of the NPN classes.
+      // The i-th variable of the cut table corresponds to the i-th leaf.
+      const auto [canonFunc, transform] =
+          NpnCanonizer::canonize(cut.table, cut.size());
 
-      auto list = getSubnets(func);
-      for(auto &option : list) {
+      auto list = getSubnets(canonFunc);
+      for (const auto &canonOption : list) {
+        // The instances are shared by the candidates of the same class.
+        auto option = NpnCanonizer::getInstance(canonOption, transform);
 
         // Creating correspondence map for subNet sources and cut.
         std::unordered_map<GateID, GateID> map;
-        const auto& sources = option.net->getSources();
-        auto it = sources.begin();
-        for(const auto & [k, v] : cutConeMap) {
-          if(it != sources.end()) {
-            map[*it] = k;
-          } else {
-            break;
-          }
-          ++it;
+        for (const auto &[i, source] : option.bindings) {
+          map[source] = cut.leaves[i];
+        }
+
+        if (journal) {
+          journal->nCandidates++;
         }
 
         if (checkOptimize(option, map)) {
@@ -84,17 +79,28 @@ namespace eda::gate::optimizer {
 
   VisitorFlags OptimizerVisitor::onNodeEnd(const GateID &) {
     // Removing invalid nodes.
-    for (const auto &it: toRemove) {
-      lastCuts->erase(*it);
+    for (const auto &cut: toRemove) {
+      lastCuts->erase(std::remove(lastCuts->begin(), lastCuts->end(), cut),
+                      lastCuts->end());
     }
     toRemove.clear();
     return finishOptimization();;
   }
 
+  void OptimizerVisitor::replace(
+      const BoundGNet &option, const std::unordered_map<GateID, GateID> &map) {
+    substitute(lastNode, map, option.net.get(), net);
+
+    if (journal) {
+      journal->nApplied++;
+      journal->replaced.push_back(lastNode);
+    }
+  }
+
   bool OptimizerVisitor::checkValidCut(const Cut &cut) {
     for (auto node: cut) {
       if (!net->contains(node)) {
-        toRemove.emplace_back(&cut);
+        toRemove.push_back(cut);
         return false;
         // Discard trivial cuts.
       } else if (node == lastNode) {
@@ -10,11 +10,14 @@
 
 #include "gate/optimizer/cuts_finder_visitor.h"
 #include "gate/optimizer/links_clean.h"
+#include "gate/optimizer/npn.h"
 #include "gate/optimizer/rwdatabase.h"
 #include "gate/optimizer/util.h"
 #include "gate/optimizer/visitor.h"
 
+#include <chrono>
 #include <queue>
+#include <vector>
 
 namespace eda::gate::optimizer {
 /**
@@ -27,6 +30,17 @@ namespace eda::gate::optimizer {
 
     using BoundGNetList = RWDatabase::BoundGNetList;
     using BoundGNet = RWDatabase::BoundGNet;
+    using Clock = std::chrono::steady_clock;
+
+    /// Records the evaluated candidates and the applied replacements.
+    struct Journal {
+      /// Number of the evaluated replacement candidates.
+      size_t nCandidates = 0;
+      /// Number of the applied replacements.
+      size_t nApplied = 0;
+      /// Nodes that have been replaced.
+      std::vector<GateID> replaced;
+    };
 
     OptimizerVisitor();
 
@@ -49,15 +63,33 @@ namespace eda::gate::optimizer {
 
     virtual BoundGNetList getSubnets(uint64_t func) = 0;
 
+    /// Called by the rewriting driver before each pass over the net.
+    virtual void startPass() {}
+
+    /// Sets the journal to record the rewriting steps to (or nullptr).
+    virtual void setJournal(Journal *journal) { this->journal = journal; }
+
+    /// Sets the time point after which the walk is stopped.
+    void setDeadline(Clock::time_point deadline) {
+      this->deadline = deadline;
+    }
+
   private:
     CutStorage *cutStorage;
 
+    Journal *journal = nullptr;
+    Clock::time_point deadline = Clock::time_point::max();
+
     CutStorage::Cuts *lastCuts;
-    std::vector<const CutStorage::Cut *> toRemove;
+    std::vector<CutStorage::Cut> toRemove;
 
     bool checkValidCut(const Cut &cut);
 
   protected:
+    /// Substitutes the subnet for the last node.
+    void replace(const BoundGNet &option,
+                 const std::unordered_map<GateID, GateID> &map);
+
     GNet *net;
     GateID lastNode;
     int cutSize;
@@ -0,0 +1,309 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/optimizer/cuts_finder.h"
+#include "gate/optimizer/rwmanager.h"
+#include "gate/optimizer/util.h"
+#include "gate/optimizer/parallel_eval_rewriter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace eda::gate::optimizer {
+
+using Clock = std::chrono::steady_clock;
+using GateStore = model::GateStore;
+
+ParallelEvalRewriter::ParallelEvalRewriter(const std::string &library,
+                                           int cutSize,
+                                           unsigned nThreads,
+                                           std::size_t windowSize,
+                                           std::size_t nCandidates):
+    cutSize(cutSize),
+    nThreads(nThreads ? nThreads
+                      : std::max(1u, std::thread::hardware_concurrency())),
+    windowSize(windowSize > 0 ? windowSize : 1),
+    nCandidates(nCandidates > 0 ? nCandidates : 1) {
+  auto &rewriteManager = RewriteManager::get();
+  rewriteManager.initialize(library);
+  database = rewriteManager.getDatabase(library);
+}
+
+/// Checks whether the cut of the node can be rewritten.
+static bool isValidCut(const model::GNet &net,
+                       model::GNet::GateId node,
+                       const CutStorage::Cut &cut) {
+  for (const auto leaf : cut) {
+    if (leaf == node || !net.contains(leaf)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Returns the number of the gates added by the subnet (the output gate
+/// replaces the root); the inverters of the transform are always counted.
+static int getSubnetSize(const RWDatabase::BoundGNet &option,
+                         const NpnTransform &transform) {
+  int size = __builtin_popcount(transform.negInputs) + transform.negOutput - 1;
+  for (const auto *gate : option.net->gates()) {
+    if (!gate->isSource() && !gate->isTarget()) {
+      size++;
+    }
+  }
+  return size;
+}
+
+RewriteStats ParallelEvalRewriter::rewrite(GNet &net, const RewriteParams &params) {
+  const auto start = Clock::now();
+  const bool limited = params.timeBudget.count() > 0;
+  const auto isExpired = [&]() {
+    return limited && Clock::now() - start >= params.timeBudget;
+  };
+
+  CutsFinder finder(cutSize, CutsFinder::DEFAULT_MAX_CUTS,
+                    CutsFinder::leafCost, nThreads);
+
+  CutStorage cutStorage;
+  finder.find(net, cutStorage);
+
+  // The workers read the gates from the store of the calling thread.
+  auto &store = model::Gate::store();
+
+  // Processes the windows by the workers.
+  const auto forEachWindow = [&](size_t nWindows, const auto &process) {
+    std::atomic<size_t> next{0};
+    const auto work = [&]() {
+      GateStore::Scope scope(store);
+      for (size_t w = next++; w < nWindows; w = next++) {
+        process(w);
+      }
+    };
+
+    const auto nWorkers = std::min<size_t>(nThreads, nWindows);
+    if (nWorkers <= 1) {
+      work();
+      return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(nWorkers);
+    for (size_t j = 0; j < nWorkers; j++) {
+      workers.emplace_back(work);
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  };
+
+  RewriteStats stats;
+  Cache cache;
+  size_t nRecut = 0;
+
+  for (size_t i = 0; i < params.maxPasses; i++) {
+    const auto passStart = Clock::now();
+    const auto nGates = net.nGates();
+
+    // The cuts of the nodes touched by the previous pass are recomputed.
+    for (const auto node : net.topologicalOrder()) {
+      if (cutStorage.cuts.find(node) == cutStorage.cuts.end()) {
+        finder.find(node, cutStorage);
+      }
+    }
+
+    const auto evalStart = Clock::now();
+    const auto windows = split(net);
+    std::vector<Matches> matches(windows.size());
+    std::vector<Candidates> candidates(windows.size());
+
+    // The database is only accessed by the calling thread: it decodes the
+    // subnets lazily, allocating the gates in the store read by the workers.
+    forEachWindow(windows.size(), [&](size_t w) {
+      match(net, cutStorage, windows[w], matches[w]);
+    });
+    for (const auto &windowMatches : matches) {
+      fetch(windowMatches, cache);
+    }
+    forEachWindow(windows.size(), [&](size_t w) {
+      evaluate(net, matches[w], cache, candidates[w]);
+    });
+
+    RewriteStats::Pass pass;
+    pass.parallelTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - evalStart);
+    std::vector<GateID> replaced;
+
+    for (const auto &windowCandidates : candidates) {
+      if (isExpired()) {
+        break;
+      }
+      reconcile(net, windowCandidates, pass, replaced);
+    }
+
+    pass.nSaved = static_cast<long>(nGates) -
+                  static_cast<long>(net.nGates());
+    pass.nRecut = nRecut;
+    pass.time = std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - passStart);
+    stats.passes.push_back(pass);
+
+    if (pass.nApplied == 0 ||
+        pass.nSaved < params.minGain * nGates ||
+        isExpired()) {
+      break;
+    }
+
+    nRecut = invalidateCuts(net, replaced, cutStorage);
+  }
+
+  return stats;
+}
+
+std::vector<ParallelEvalRewriter::Window> ParallelEvalRewriter::split(
+    const GNet &net) const {
+  // The topological order is the concatenation of the levels.
+  const auto order = net.topologicalOrder();
+
+  std::vector<Window> windows;
+  windows.reserve((order.size() + windowSize - 1) / windowSize);
+
+  for (size_t begin = 0; begin < order.size(); begin += windowSize) {
+    const auto end = std::min(begin + windowSize, order.size());
+    windows.emplace_back(order.begin() + begin, order.begin() + end);
+  }
+
+  return windows;
+}
+
+void ParallelEvalRewriter::match(const GNet &net,
+                           const CutStorage &cutStorage,
+                           const Window &window,
+                           Matches &matches) const {
+  for (const auto node : window) {
+    const auto i = cutStorage.cuts.find(node);
+    if (i == cutStorage.cuts.end()) {
+      continue;
+    }
+
+    for (const auto &cut : i->second) {
+      if (cut.size() > NpnTransform::MAX_VARS || !isValidCut(net, node, cut)) {
+        continue;
+      }
+
+      const auto [canonFunc, transform] =
+          NpnCanonizer::canonize(cut.table, cut.size());
+      matches.push_back({node, &cut, canonFunc, transform});
+    }
+  }
+}
+
+void ParallelEvalRewriter::fetch(const Matches &matches, Cache &cache) const {
+  for (const auto &match : matches) {
+    if (cache.find(match.func) == cache.end()) {
+      cache.emplace(match.func, database->get(match.func));
+    }
+  }
+}
+
+void ParallelEvalRewriter::evaluate(const GNet &net,
+                              const Matches &matches,
+                              const Cache &cache,
+                              Candidates &candidates) const {
+  for (size_t i = 0; i < matches.size();) {
+    const auto node = matches[i].node;
+    const auto first = candidates.size();
+
+    for (; i < matches.size() && matches[i].node == node; i++) {
+      const auto &match = matches[i];
+
+      const auto &subnets = cache.at(match.func);
+      if (subnets.empty()) {
+        continue;
+      }
+
+      // The root is replaced by the subnet's output.
+      const auto &cut = *match.cut;
+      const int nRemoved = static_cast<int>(mffcSize(net, node, cut)) - 1;
+
+      for (const auto &option : subnets) {
+        const int estimate = getSubnetSize(option, match.transform) - nRemoved;
+        candidates.push_back({node, cut, option, match.transform, estimate});
+      }
+    }
+
+    // Only the best candidates of the node are checked exactly.
+    const auto begin = candidates.begin() + first;
+    std::stable_sort(begin, candidates.end(),
+        [](const Candidate &lhs, const Candidate &rhs) {
+          return lhs.estimate < rhs.estimate;
+        });
+
+    if (candidates.size() - first > nCandidates) {
+      candidates.erase(begin + nCandidates, candidates.end());
+    }
+  }
+}
+
+void ParallelEvalRewriter::reconcile(GNet &net,
+                               const Candidates &candidates,
+                               RewriteStats::Pass &pass,
+                               std::vector<GateID> &replaced) const {
+  for (size_t i = 0; i < candidates.size();) {
+    const auto node = candidates[i].node;
+
+    size_t j = i;
+    while (j < candidates.size() && candidates[j].node == node) {
+      j++;
+    }
+
+    // The node may have been removed by a replacement.
+    if (!net.contains(node)) {
+      i = j;
+      continue;
+    }
+
+    int bestReduce = 1;
+    BoundGNet bestOption;
+    std::unordered_map<GateID, GateID> bestMap;
+
+    for (; i < j; i++) {
+      const auto &candidate = candidates[i];
+      if (!isValidCut(net, node, candidate.cut)) {
+        continue;
+      }
+
+      const auto &option = NpnCanonizer::getInstance(candidate.option,
+                                                     candidate.transform);
+
+      std::unordered_map<GateID, GateID> map;
+      for (const auto &[input, source] : option.bindings) {
+        map[source] = candidate.cut.leaves[input];
+      }
+
+      pass.nCandidates++;
+
+      const int reduce = fakeSubstitute(node, map, option.net.get(), &net);
+      if (reduce < bestReduce) {
+        bestReduce = reduce;
+        bestOption = option;
+        bestMap = std::move(map);
+      }
+    }
+
+    if (bestReduce <= 0) {
+      substitute(node, bestMap, bestOption.net.get(), &net);
+
+      pass.nApplied++;
+      replaced.push_back(node);
+    }
+  }
+}
+
+} // namespace eda::gate::optimizer
@@ -0,0 +1,127 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "gate/model/gnet.h"
+#include "gate/optimizer/cut_storage.h"
+#include "gate/optimizer/npn.h"
+#include "gate/optimizer/optimizer.h"
+#include "gate/optimizer/rwdatabase.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eda::gate::optimizer {
+
+/**
+ * \brief Implements the rewriting of a net w/ the concurrent evaluation
+ * of the candidates.
+ *
+ * The net is split into windows, i.e. chunks of windowSize consecutive
+ * gates of the topological order (which goes level by level). The windows
+ * are not disjoint regions: the cuts and the MFFCs of a window may reach
+ * into the preceding ones. Only the evaluation is concurrent: the cuts of
+ * each node are canonized, the subnets are fetched from the database (this
+ * step is serial, since the database decodes the subnets lazily), and they
+ * are ranked by the estimated gain (the size of the MFFC bounded by the cut
+ * minus the size of the subnet), which is computed w/o modifying the net.
+ * Then, window by window, the best candidates of each node are reconciled
+ * w/ the replacements made so far: they are instantiated, checked exactly
+ * (see fakeSubstitute), and applied as ExhausitiveSearchOptimizer does.
+ * This phase is serial, since neither the net nor the gate store is
+ * thread-safe, so the speedup is bounded by the share of the evaluation in
+ * a pass (see RewriteStats::Pass::parallelTime). The result does not depend
+ * on the number of threads.
+ */
+class ParallelEvalRewriter final {
+public:
+  using GNet = model::GNet;
+  using GateID = GNet::GateId;
+  using Cut = CutStorage::Cut;
+  using BoundGNet = RWDatabase::BoundGNet;
+  using BoundGNetList = RWDatabase::BoundGNetList;
+  using TruthTable = RWDatabase::TruthTable;
+
+  /// Default number of the gates in a window.
+  static constexpr std::size_t DEFAULT_WINDOW_SIZE = 4096;
+  /// Default number of the candidates per node that are checked exactly.
+  static constexpr std::size_t DEFAULT_CANDIDATES = 2;
+
+  ParallelEvalRewriter(const std::string &library,
+                       int cutSize,
+                       unsigned nThreads = 0,
+                       std::size_t windowSize = DEFAULT_WINDOW_SIZE,
+                       std::size_t nCandidates = DEFAULT_CANDIDATES);
+
+  /// Rewrites the net pass by pass (the passes are controlled as in
+  /// optimize()) and returns the per-pass statistics.
+  RewriteStats rewrite(GNet &net,
+                       const RewriteParams &params = RewriteParams());
+
+private:
+  /// Replacement candidate of a node.
+  struct Candidate {
+    GateID node;
+    Cut cut;
+    /// Canonical subnet and the transform to instantiate it.
+    BoundGNet option;
+    NpnTransform transform;
+    /// Estimated change of the net size.
+    int estimate;
+  };
+
+  /// Canonized cut of a node.
+  struct Match {
+    GateID node;
+    const Cut *cut;
+    TruthTable func;
+    NpnTransform transform;
+  };
+
+  using Window = std::vector<GateID>;
+  using Matches = std::vector<Match>;
+  using Candidates = std::vector<Candidate>;
+  using Cache = std::unordered_map<TruthTable, BoundGNetList>;
+
+  /// Splits the net into the bands of consecutive logic levels.
+  std::vector<Window> split(const GNet &net) const;
+
+  /// Canonizes the valid cuts of the nodes of the window (thread-safe).
+  void match(const GNet &net,
+             const CutStorage &cutStorage,
+             const Window &window,
+             Matches &matches) const;
+
+  /// Fetches the subnets of the matched functions from the database.
+  void fetch(const Matches &matches, Cache &cache) const;
+
+  /// Finds the best candidates for the matched nodes (thread-safe).
+  void evaluate(const GNet &net,
+                const Matches &matches,
+                const Cache &cache,
+                Candidates &candidates) const;
+
+  /// Checks the candidates of the window and applies the best ones.
+  void reconcile(GNet &net,
+                 const Candidates &candidates,
+                 RewriteStats::Pass &pass,
+                 std::vector<GateID> &replaced) const;
+
+  std::shared_ptr<RWDatabase> database;
+
+  const int cutSize;
+  const unsigned nThreads;
+  const std::size_t windowSize;
+  const std::size_t nCandidates;
+};
+
+} // namespace eda::gate::optimizer
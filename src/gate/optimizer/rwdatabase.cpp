@@ -8,9 +8,16 @@
 
 #include "rwdatabase.h"
 
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
 #include <map>
 #include <memory>
 #include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <vector>
 
 using BoundGNet = eda::gate::optimizer::RWDatabase::BoundGNet;
@@ -19,6 +26,7 @@ using Gate = eda::gate::model::Gate;
 using GateList = std::vector<Gate::Id>;
 using GateSymbol = eda::gate::model::GateSymbol;
 using GNet = eda::gate::model::GNet;
+using BinaryRWDatabase = eda::gate::optimizer::BinaryRWDatabase;
 using RWDatabase = eda::gate::optimizer::RWDatabase;
 using SQLiteRWDatabase = eda::gate::optimizer::SQLiteRWDatabase;
 
@@ -288,4 +296,279 @@ void SQLiteRWDatabase::deleteFromDB(const TruthTable &key) {
   }
 }
 
+std::vector<std::pair<RWDatabase::TruthTable, BoundGNetList>>
+SQLiteRWDatabase::selectAllFromDB() {
+  assert(_isOpened);
+  _selectResult.clear();
+  std::string sql = "SELECT * FROM " + _dbTableName;
+  _rc = sqlite3_exec(_db, sql.c_str(), selectSQLCallback,
+                     (void*)(&_selectResult), &_zErrMsg);
+  if (_rc != SQLITE_OK) {
+    std::cout << sqlite3_errmsg(_db) << '\n';
+    throw "Can't select.";
+  }
+
+  std::vector<std::pair<TruthTable, BoundGNetList>> result;
+  result.reserve(_selectResult.size());
+  for (const auto &[key, value] : _selectResult) {
+    // The keys are stored as signed 64-bit integers.
+    result.emplace_back(static_cast<TruthTable>(std::stoll(key)),
+                        deserialize(value));
+  }
+  return result;
+}
+
+void BinaryRWDatabase::write(const std::string &path,
+                             std::vector<Entry> entries) {
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry &lhs, const Entry &rhs) {
+              return lhs.first < rhs.first;
+            });
+
+  std::vector<IndexEntry> index;
+  std::vector<uint32_t> words;
+
+  for (const auto &[key, list] : entries) {
+    if (!index.empty() && index.back().key == key) {
+      throw "Duplicate truth table.";
+    }
+    index.push_back({key, static_cast<uint32_t>(words.size()),
+                     static_cast<uint32_t>(list.size())});
+
+    for (const auto &bGNet : list) {
+      const auto &net = *bGNet.net;
+      if (!net.isSorted()) {
+        throw "Net isn't topologically sorted.";
+      }
+
+      // The gates are referred to by their positions in the net.
+      std::unordered_map<Gate::Id, uint32_t> gateIndex;
+      for (const auto *gate : net.gates()) {
+        gateIndex.emplace(gate->id(), gateIndex.size());
+      }
+
+      words.push_back(net.gates().size());
+      words.push_back(bGNet.bindings.size());
+      words.push_back(bGNet.inputsDelay.size());
+
+      for (const auto &[input, gid] : bGNet.bindings) {
+        words.push_back(input);
+        words.push_back(gateIndex.at(gid));
+      }
+
+      for (const auto &[input, delay] : bGNet.inputsDelay) {
+        uint64_t bits;
+        std::memcpy(&bits, &delay, sizeof(bits));
+        words.push_back(input);
+        words.push_back(static_cast<uint32_t>(bits));
+        words.push_back(static_cast<uint32_t>(bits >> 32));
+      }
+
+      for (const auto *gate : net.gates()) {
+        assert(gate->arity() <= 0xffff);
+        words.push_back((static_cast<uint32_t>(gate->func()) << 16) |
+                        gate->arity());
+        for (const auto &signal : gate->inputs()) {
+          words.push_back(gateIndex.at(signal.node()));
+        }
+      }
+    }
+  }
+
+  Header header;
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.nKeys = index.size();
+  header.nWords = words.size();
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out.good()) {
+    throw "Can't open database file.";
+  }
+
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(index.data()),
+            index.size() * sizeof(IndexEntry));
+  out.write(reinterpret_cast<const char*>(words.data()),
+            words.size() * sizeof(uint32_t));
+
+  if (!out.good()) {
+    throw "Can't write database file.";
+  }
+}
+
+void BinaryRWDatabase::convert(const std::string &sqlitePath,
+                               const std::string &path) {
+  SQLiteRWDatabase sqliteDB;
+  sqliteDB.linkDB(sqlitePath);
+  sqliteDB.openDB();
+  auto entries = sqliteDB.selectAllFromDB();
+  sqliteDB.closeDB();
+
+  write(path, std::move(entries));
+}
+
+void BinaryRWDatabase::openDB(const std::string &path) {
+  closeDB();
+
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw "Can't open database file.";
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(Header)) {
+    ::close(fd);
+    throw "Invalid database file.";
+  }
+
+  void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+
+  if (data == MAP_FAILED) {
+    throw "Can't map database file.";
+  }
+
+  _data = data;
+  _size = st.st_size;
+
+  const auto *header = static_cast<const Header*>(_data);
+  const size_t indexSize = header->nKeys * sizeof(IndexEntry);
+
+  if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      header->version != VERSION ||
+      _size != sizeof(Header) + indexSize + header->nWords * sizeof(uint32_t)) {
+    closeDB();
+    throw "Invalid database file.";
+  }
+
+  const auto *bytes = static_cast<const char*>(_data);
+  _index = reinterpret_cast<const IndexEntry*>(bytes + sizeof(Header));
+  _words = reinterpret_cast<const uint32_t*>(bytes + sizeof(Header) +
+                                             indexSize);
+  _nKeys = header->nKeys;
+  _nWords = header->nWords;
+}
+
+void BinaryRWDatabase::closeDB() {
+  if (_data) {
+    munmap(_data, _size);
+  }
+
+  _data = nullptr;
+  _size = 0;
+  _index = nullptr;
+  _words = nullptr;
+  _nKeys = 0;
+  _nWords = 0;
+}
+
+const BinaryRWDatabase::IndexEntry *
+BinaryRWDatabase::find(const TruthTable &key) const {
+  const auto *end = _index + _nKeys;
+  const auto *i = std::lower_bound(_index, end, key,
+                                   [](const IndexEntry &entry,
+                                      const TruthTable &key) {
+                                     return entry.key < key;
+                                   });
+  return (i != end && i->key == key) ? i : nullptr;
+}
+
+BoundGNet BinaryRWDatabase::decode(const uint32_t *&word) const {
+  // The file is not trusted: all the offsets and indices are checked.
+  const auto *end = _words + _nWords;
+  const auto next = [&word, end](size_t n) {
+    if (static_cast<size_t>(end - word) < n) {
+      throw "Invalid database file.";
+    }
+    const auto *data = word;
+    word += n;
+    return data;
+  };
+
+  BoundGNet bGNet;
+  bGNet.net = std::make_shared<GNet>();
+
+  const auto *counts = next(3);
+  const auto nGates = counts[0];
+  const auto nBindings = counts[1];
+  const auto nDelays = counts[2];
+
+  const auto *bindings = next(2 * static_cast<size_t>(nBindings));
+
+  for (size_t i = 0; i < nDelays; i++) {
+    const auto *delayWords = next(3);
+    const uint64_t bits = delayWords[1] |
+                          (static_cast<uint64_t>(delayWords[2]) << 32);
+    double delay;
+    std::memcpy(&delay, &bits, sizeof(delay));
+    bGNet.inputsDelay[delayWords[0]] = delay;
+  }
+
+  std::vector<Gate::Id> gates;
+  gates.reserve(std::min<size_t>(nGates, end - word));
+  for (size_t i = 0; i < nGates; i++) {
+    const auto header = *next(1);
+    if ((header >> 16) >= GateSymbol::XXX) {
+      throw "Invalid database file.";
+    }
+    const auto func = static_cast<GateSymbol::Value>(header >> 16);
+    const auto arity = header & 0xffff;
+
+    const auto *fanins = next(arity);
+
+    Gate::SignalList inputs;
+    inputs.reserve(arity);
+    for (size_t j = 0; j < arity; j++) {
+      if (fanins[j] >= i) {
+        throw "Invalid database file.";
+      }
+      inputs.push_back(Gate::Signal::always(gates[fanins[j]]));
+    }
+    gates.push_back(bGNet.net->addGate(func, inputs));
+  }
+
+  for (size_t i = 0; i < nBindings; i++) {
+    if (bindings[2 * i + 1] >= nGates) {
+      throw "Invalid database file.";
+    }
+    bGNet.bindings[bindings[2 * i]] = gates[bindings[2 * i + 1]];
+  }
+
+  bGNet.net->sortTopologically();
+  return bGNet;
+}
+
+bool BinaryRWDatabase::contains(const TruthTable &key) {
+  if (_storage.find(key) != _storage.end()) {
+    return true;
+  }
+  return _data && find(key);
+}
+
+BoundGNetList BinaryRWDatabase::get(const TruthTable &key) {
+  if (_storage.find(key) != _storage.end()) {
+    return _storage[key];
+  }
+  if (_data) {
+    if (const auto *entry = find(key)) {
+      if (entry->offset >= _nWords) {
+        throw "Invalid database file.";
+      }
+
+      BoundGNetList list;
+      list.reserve(entry->nNets);
+
+      const uint32_t *word = _words + entry->offset;
+      for (size_t i = 0; i < entry->nNets; i++) {
+        list.push_back(decode(word));
+      }
+
+      set(key, list);
+      return list;
+    }
+  }
+  return BoundGNetList();
+}
+
 } // namespace eda::gate::optimizer
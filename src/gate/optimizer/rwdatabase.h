@@ -14,10 +14,13 @@
 #include "sqlite3-bind.h"
 #include "sqlite3.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace eda::gate::optimizer {
@@ -126,6 +129,9 @@ namespace eda::gate::optimizer {
     // Delete value from DB.
     void deleteFromDB(const TruthTable &key);
 
+    // Selects all the entries from DB.
+    std::vector<std::pair<TruthTable, BoundGNetList>> selectAllFromDB();
+
   private:
 
     bool dbContainsRWTable();
@@ -135,7 +141,8 @@ namespace eda::gate::optimizer {
                                  char **argv,
                                  char **azColName) {
       std::string arg1 = std::string(argv[0] == nullptr ? "NULL" : argv[0]);
-      std::string arg2 = std::string(argv[1] == nullptr ? "NULL" : argv[1]);
+      std::string arg2 = std::string(argc < 2 || argv[1] == nullptr
+                                     ? "NULL" : argv[1]);
       ((std::vector<std::pair<std::string, std::string> >*)selectResultPointer)
               ->push_back(std::pair<std::string, std::string>(arg1, arg2));
       return 0;
@@ -156,4 +163,79 @@ namespace eda::gate::optimizer {
     std::vector<std::pair<std::string, std::string> > _selectResult;
   };
 
+/**
+* \brief Implements read-only storage that contains GNets for rewriting
+* using a memory-mapped binary file.
+*
+* The file consists of the fixed header, the index sorted by the truth tables
+* and the packed array of 32-bit words describing the nets. The entries are
+* decoded lazily on get().
+*/
+  class BinaryRWDatabase : public RWDatabase {
+  public:
+    using Entry = std::pair<TruthTable, BoundGNetList>;
+
+    // File signature.
+    static constexpr char MAGIC[8] = {'U', 'T', 'O', 'P', 'I', 'A', 'R', 'W'};
+    // Format version.
+    static constexpr uint32_t VERSION = 1;
+
+    BinaryRWDatabase() = default;
+    BinaryRWDatabase(const BinaryRWDatabase &) = delete;
+    BinaryRWDatabase &operator =(const BinaryRWDatabase &) = delete;
+
+    virtual ~BinaryRWDatabase() { closeDB(); }
+
+    // Writes the entries to the file (the nets must be sorted).
+    static void write(const std::string &path, std::vector<Entry> entries);
+
+    // Converts the SQLite database to the binary file.
+    static void convert(const std::string &sqlitePath,
+                        const std::string &path);
+
+    // Maps the file into memory. You must call it before you use
+    // BinaryRWDatabase.
+    void openDB(const std::string &path);
+
+    // Unmaps the file.
+    void closeDB();
+
+    // Returns the number of truth tables in the file.
+    size_t size() const { return _nKeys; }
+
+    // Basic interface.
+
+    // Find for the key in the local storage and in the file.
+    virtual bool contains(const TruthTable &key);
+
+    // Get element from the local storage or from the file.
+    virtual BoundGNetList get(const TruthTable &key);
+
+  private:
+    struct Header {
+      char magic[8];
+      uint32_t version;
+      uint32_t nKeys;
+      uint64_t nWords;
+    };
+
+    struct IndexEntry {
+      TruthTable key;
+      uint32_t offset;
+      uint32_t nNets;
+    };
+
+    const IndexEntry *find(const TruthTable &key) const;
+
+    BoundGNet decode(const uint32_t *&word) const;
+
+    void *_data = nullptr;
+    size_t _size = 0;
+
+    const IndexEntry *_index = nullptr;
+    const uint32_t *_words = nullptr;
+    size_t _nKeys = 0;
+    size_t _nWords = 0;
+  };
+
 } // namespace eda::gate::optimizer
\ No newline at end of file
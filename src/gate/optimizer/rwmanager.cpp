@@ -13,9 +13,15 @@
 namespace eda::gate::optimizer {
 
 void RewriteManager::initialize(const std::string &library) {
+  auto &db = databases();
   const auto i = db.find(library);
   if (i == db.end()) {
-    if (library == DEFAULT) {
+    const auto binary = binaries.find(library);
+    if (binary != binaries.end()) {
+      auto database = std::make_shared<BinaryRWDatabase>();
+      database->openDB(binary->second);
+      db.emplace(library, database);
+    } else if (library == DEFAULT) {
       auto database = std::make_shared<RWDatabase>();
       initializeAbcRwDatabase(*database);
       db.emplace(library, database);
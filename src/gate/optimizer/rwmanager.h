@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "gate/model/gate.h"
 #include "util/singleton.h"
 
 #include <cassert>
@@ -24,24 +25,44 @@ class RewriteManager final : public util::Singleton<RewriteManager> {
   static constexpr const char *DEFAULT = "abc";
 
 public:
+  /// Sets the binary database file (see BinaryRWDatabase) to be used for
+  /// the given library instead of the built-in one. The file is mapped by
+  /// initialize() in each gate store; the nets are decoded on demand.
+  void setBinary(const std::string &path,
+                 const std::string &library = DEFAULT) {
+    binaries[library] = path;
+  }
+
   /// Initializes the rewriting database for the given library.
   void initialize(const std::string &library = DEFAULT);
 
-  /// Returns the database for the given library.
-  const RWDatabase &getDatabase(const std::string &library = DEFAULT) const {
+  /// Returns the database for the given library (shared by its users).
+  std::shared_ptr<RWDatabase> getDatabase(
+      const std::string &library = DEFAULT) const {
+    const auto &db = databases();
     const auto i = db.find(library);
     assert(i != db.end());
-    return *i->second;
+    return i->second;
   }
   
   std::shared_ptr<RWDatabase> createDatabase(const std::string &library) {
     auto database = std::make_shared<RWDatabase>();
-    db.emplace(library, database);
+    databases().emplace(library, database);
     return database;
   }
 
 private:
-  std::unordered_map<std::string, std::shared_ptr<RWDatabase>> db;
+  using DatabaseMap =
+      std::unordered_map<std::string, std::shared_ptr<RWDatabase>>;
+
+  /// Returns the databases of the current gate store: the database nets
+  /// consist of the store's gates and are destroyed together with them.
+  static DatabaseMap &databases() {
+    return model::GateBase::store().local<DatabaseMap>();
+  }
+
+  /// Binary database files of the libraries.
+  std::unordered_map<std::string, std::string> binaries;
 };
 
 } // namespace eda::gate::optimizer
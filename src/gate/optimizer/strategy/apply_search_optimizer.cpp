@@ -19,11 +19,11 @@ namespace eda::gate::optimizer {
   void
   ApplySearchOptimizer::considerOptimization(BoundGNet &option,
                                              std::unordered_map<GateID, GateID> &map) {
-    substitute(lastNode, map, option.net.get(), net);
+    replace(option, map);
   }
 
   BoundGNetList
   ApplySearchOptimizer::getSubnets(uint64_t func) {
-    return rwdb.get(func);
+    return rwdb->get(func);
   }
 } // namespace eda::gate::optimizer
@@ -22,7 +22,7 @@ namespace eda::gate::optimizer {
       rwdb = rewriteManager.getDatabase();
     }
 
-    RWDatabase rwdb;
+    std::shared_ptr<RWDatabase> rwdb;
     bool checkOptimize(const BoundGNet &option,
                        const std::unordered_map<GateID, GateID> &map) override;
 
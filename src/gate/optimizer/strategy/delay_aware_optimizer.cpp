@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/optimizer/strategy/delay_aware_optimizer.h"
+
+#include <vector>
+
+namespace eda::gate::optimizer {
+  using BoundGNetList = RWDatabase::BoundGNetList;
+
+  bool DelayAwareOptimizer::checkOptimize(const BoundGNet &option,
+                                          const std::unordered_map<GateID, GateID> &map) {
+    const unsigned level = fakeLevel(lastNode, map, option.net.get(), net);
+    if (level > getRequired(lastNode)) {
+      return false;
+    }
+
+    const int area = fakeSubstitute(lastNode, map, option.net.get(), net);
+    const int delta = static_cast<int>(level) -
+                      static_cast<int>(net->getLogicLevel(lastNode));
+    const float cost = (1 - delayWeight) * area + delayWeight * delta;
+
+    if (cost >= 0 && (area > 0 || delta > 0)) {
+      return false;
+    }
+
+    if (!found || cost < bestCost ||
+        (cost == bestCost && (area < bestArea ||
+                              (area == bestArea && delta < bestDelta)))) {
+      found = true;
+      bestCost = cost;
+      bestArea = area;
+      bestDelta = delta;
+      bestOption = option;
+      bestOptionMap = map;
+    }
+
+    // All the candidates of the node are examined to choose the best one.
+    return false;
+  }
+
+  void
+  DelayAwareOptimizer::considerOptimization(BoundGNet &option,
+                                            std::unordered_map<GateID, GateID> &map) {
+    bestOption = std::move(option);
+    bestOptionMap = std::move(map);
+  }
+
+  BoundGNetList
+  DelayAwareOptimizer::getSubnets(uint64_t func) {
+    return rwdb->get(func);
+  }
+
+  VisitorFlags DelayAwareOptimizer::finishOptimization() {
+    if (found) {
+      replace(bestOption, bestOptionMap);
+      tightenRequired(lastNode);
+    }
+    found = false;
+    return SUCCESS;
+  }
+
+  void DelayAwareOptimizer::startPass() {
+    required.clear();
+
+    const auto order = net->topologicalOrder();
+    const unsigned depth = net->nLogicLevels() ? net->nLogicLevels() - 1 : 0;
+
+    for (auto i = order.rbegin(); i != order.rend(); i++) {
+      unsigned level = depth;
+      for (const auto &link : Gate::get(*i)->links()) {
+        if (!net->contains(link.target)) {
+          continue;
+        }
+        // The triggers' inputs are required at the end of the cycle.
+        const auto *target = Gate::get(link.target);
+        if (!target->isTrigger()) {
+          level = std::min(level, required[link.target] - 1);
+        }
+      }
+      required[*i] = level;
+    }
+  }
+
+  unsigned DelayAwareOptimizer::getRequired(GateID gid) const {
+    const auto i = required.find(gid);
+    // The gates added during the pass are considered to be critical.
+    return i != required.end() ? i->second : net->getLogicLevel(gid);
+  }
+
+  void DelayAwareOptimizer::tightenRequired(GateID node) {
+    std::vector<GateID> stack{node};
+    required.emplace(node, net->getLogicLevel(node));
+
+    while (!stack.empty()) {
+      const auto gid = stack.back();
+      stack.pop_back();
+
+      const auto *gate = Gate::get(gid);
+      const auto level = required[gid];
+      if (level == 0 || gate->isTrigger()) {
+        continue;
+      }
+
+      for (const auto &input : gate->inputs()) {
+        const auto source = input.node();
+        if (!net->contains(source)) {
+          continue;
+        }
+
+        const auto i = required.find(source);
+        if (i == required.end()) {
+          required.emplace(source, level - 1);
+        } else if (i->second > level - 1) {
+          i->second = level - 1;
+        } else {
+          continue;
+        }
+        stack.push_back(source);
+      }
+    }
+  }
+
+} // namespace eda::gate::optimizer
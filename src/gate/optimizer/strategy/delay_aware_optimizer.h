@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "gate/optimizer/optimizer_visitor.h"
+#include "gate/optimizer/rwmanager.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace eda::gate::optimizer {
+
+  /**
+   * \brief Rewriting strategy that takes into account the logic depth.
+   *
+   * The arrival level of a gate is its logic level in the net; the required
+   * level is computed backward from the depth of the net at the beginning of
+   * each pass and is tightened locally after each replacement. A candidate
+   * is rejected if the new level of the node exceeds its required level, so
+   * the depth of the net is never increased. The remaining candidates are
+   * ranked by the cost (1 - w) * dArea + w * dLevel, where w is the delay
+   * weight: w = 0 minimizes the area, while w = 1 minimizes the depth.
+   * A candidate is applied if its cost is negative or if it increases
+   * neither the area nor the level of the node.
+   */
+  class DelayAwareOptimizer : public OptimizerVisitor {
+
+  public:
+    DelayAwareOptimizer(const char* namefile, float delayWeight = 0.5) {
+      RewriteManager& rewriteManager = RewriteManager::get();
+      rewriteManager.initialize(namefile);
+      rwdb = rewriteManager.getDatabase(namefile);
+      setDelayWeight(delayWeight);
+    }
+
+    /// Sets the weight of the level change in the cost (from 0 to 1).
+    void setDelayWeight(float delayWeight) {
+      this->delayWeight = std::min(1.0f, std::max(0.0f, delayWeight));
+    }
+
+    bool checkOptimize(const BoundGNet &option,
+                       const std::unordered_map<GateID, GateID> &map) override;
+
+    /// Is not called: checkOptimize() keeps the best candidate itself and
+    /// returns false, so that all the cuts of the node are examined (the
+    /// best one is applied by finishOptimization()). The override remains
+    /// since the method is pure virtual in OptimizerVisitor.
+    void considerOptimization(BoundGNet &option,
+                              std::unordered_map<GateID, GateID> &map) override;
+
+    BoundGNetList getSubnets(uint64_t func) override;
+
+    VisitorFlags finishOptimization() override;
+
+    void startPass() override;
+
+  private:
+    /// Returns the required level of the gate.
+    unsigned getRequired(GateID gid) const;
+
+    /// Propagates the required level of the node to its new fanin cone.
+    void tightenRequired(GateID node);
+
+    std::shared_ptr<RWDatabase> rwdb;
+    float delayWeight;
+
+    std::unordered_map<GateID, unsigned> required;
+
+    BoundGNet bestOption;
+    std::unordered_map<GateID, GateID> bestOptionMap;
+    bool found = false;
+    float bestCost;
+    int bestArea;
+    int bestDelta;
+
+  };
+} // namespace eda::gate::optimizer
@@ -30,12 +30,12 @@ namespace eda::gate::optimizer {
 
   BoundGNetList
   ExhausitiveSearchOptimizer::getSubnets(uint64_t func) {
-    return rwdb.get(func);
+    return rwdb->get(func);
   }
 
   VisitorFlags ExhausitiveSearchOptimizer::finishOptimization() {
     if(bestReduce <= 0) {
-      substitute(lastNode, bestOptionMap, bestOption.net.get(), net);
+      replace(bestOption, bestOptionMap);
     }
     bestReduce = 1;
     return SUCCESS;
@@ -33,7 +33,7 @@ namespace eda::gate::optimizer {
     VisitorFlags finishOptimization() override;
 
   private:
-    RWDatabase rwdb;
+    std::shared_ptr<RWDatabase> rwdb;
     BoundGNet bestOption;
     std::unordered_map<GateID, GateID> bestOptionMap;
     int bestReduce = 1;
@@ -47,6 +47,15 @@ namespace eda::gate::optimizer {
     return visitor->finishOptimization();
   }
 
+  void TrackStrategy::setJournal(Journal *journal) {
+    OptimizerVisitor::setJournal(journal);
+    visitor->setJournal(journal);
+  }
+
+  void TrackStrategy::startPass() {
+    visitor->startPass();
+  }
+
   VisitorFlags TrackStrategy::onNodeBegin(const GateID &id) {
     visitor->onNodeBegin(id);
     return OptimizerVisitor::onNodeBegin(id);
@@ -33,6 +33,10 @@ namespace eda::gate::optimizer {
 
     VisitorFlags finishOptimization() override;
 
+    void setJournal(Journal *journal) override;
+
+    void startPass() override;
+
   private:
     std::filesystem::path subCatalog;
     OptimizerVisitor *visitor;
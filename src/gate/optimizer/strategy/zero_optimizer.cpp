@@ -19,7 +19,7 @@ namespace eda::gate::optimizer {
   void
   ZeroOptimizer::considerOptimization(BoundGNet &option,
                                       std::unordered_map<GateID, GateID> &map) {
-    substitute(lastNode, map, option.net.get(), net);
+    replace(option, map);
   }
 
   // TODO: correct method.
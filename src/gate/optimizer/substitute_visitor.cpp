@@ -45,10 +45,12 @@ namespace eda::gate::optimizer {
         GateID changeGate;
         Gate *cutForGate = Gate::get(cutFor);
         if (cutForGate->isTarget()) {
-          if(signals.size() > 1) {
+          // The output is connected directly only to a buffered signal
+          // (inverters and constants are materialized as gates).
+          if (subGate->func() != GateSymbol::NOP || signals.size() != 1) {
             changeGate = nodes[subGate->id()] = net->addGate(subGate->func(),
                                                              signals);
-            signals = {changeGate};
+            signals = {Gate::Signal::always(changeGate)};
             nodes[subGate->id()] = changeGate;
           }
           changeGate = nodes[subGate->id()] = cutFor;
@@ -70,10 +72,7 @@ namespace eda::gate::optimizer {
           return FINISH_ALL;
         }
         // Deleting links.
-        LinkCleanVisitor visitor(changeGate, net, signals);
-        Walker walker(net, &visitor, nullptr);
-        // TODO Change to found earlier cone.
-        walker.walk(cutFor, false);
+        cleanLinks(changeGate, net, signals);
         return FINISH_ALL;
       } else {
         nodes[subGate->id()] = net->addGate(subGate->func(), signals);
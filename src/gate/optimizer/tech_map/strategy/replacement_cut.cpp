@@ -45,8 +45,9 @@ namespace eda::gate::optimizer {
   VisitorFlags ReplacementVisitor::onNodeEnd(const GateID &) {
     finishTechMap();
     // Removing invalid nodes.
-    for (const auto &it: toRemove) {
-      lastCuts->erase(*it);
+    for (const auto &cut: toRemove) {
+      lastCuts->erase(std::remove(lastCuts->begin(), lastCuts->end(), cut),
+                      lastCuts->end());
     }
     toRemove.clear();
     return SUCCESS;
@@ -55,7 +56,7 @@ namespace eda::gate::optimizer {
   bool ReplacementVisitor::checkValidCut(const Cut &cut) {
     for (auto node: cut) {
       if (!net->contains(node)) {
-        toRemove.emplace_back(&cut);
+        toRemove.push_back(cut);
         return false;
         // Discard trivial cuts.
       } else if (node == lastNode) {
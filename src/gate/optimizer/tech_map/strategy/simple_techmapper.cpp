@@ -31,7 +31,7 @@ namespace eda::gate::optimizer {
 
   BoundGNetList
   SimpleTechMapper::getSubnets(uint64_t func) {
-    return rwdb.get(func);
+    return rwdb->get(func);
   }
 
   void SimpleTechMapper::finishTechMap() {
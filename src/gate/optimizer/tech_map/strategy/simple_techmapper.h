@@ -28,7 +28,7 @@ namespace eda::gate::optimizer {
     }
 
   protected:
-    RWDatabase rwdb;
+    std::shared_ptr<RWDatabase> rwdb;
 
     double minNodeArrivalTime = std::numeric_limits<double>::max();
 
@@ -39,37 +39,21 @@ namespace eda::gate::optimizer {
 
   VisitorFlags TechMapVisitor::onCut(const Visitor::Cut &cut) {
     if (checkValidCut(cut)) {
-      // Finding cone.
-      ConeVisitor coneVisitor(cut);
-      Walker walker(net, &coneVisitor, nullptr);
-      walker.walk(lastNode, cut, false);
-
-      // Make binding.
-      RWDatabase::BoundGNet boundGNet;
-      boundGNet.net = std::shared_ptr<GNet>(coneVisitor.getGNet());
-
-      const auto & cutConeMap = coneVisitor.getResultCut();
-      for(const auto &[gateSource, gateCone] : cutConeMap) {
-        boundGNet.bindings[boundGNet.bindings.size()] = gateCone;
+      if (cut.size() > CutStorage::Cut::MAX_TABLE_SIZE) {
+        return SUCCESS;
       }
 
-      auto func = TTBuilder::build(boundGNet);
-      auto list = getSubnets(func);
+      // The i-th variable of the cut table corresponds to the i-th leaf.
+      auto list = getSubnets(cut.table);
       for(auto &superGate : list) {
         // Creating correspondence map for subNet sources and cut.
         std::unordered_map<GateID, GateID> map;
-
-        const auto& sources = superGate.net->getSources();
-        auto it = sources.begin();
-
-        for(const auto & [k, v] : cutConeMap) {
-          if(it != sources.end()) {
-            map[*it] = k;
-          } else {
-            break;
+        for (const auto &[i, source] : superGate.bindings) {
+          if (i < cut.size()) {
+            map[source] = cut.leaves[i];
           }
-          ++it;
         }
+
         if (checkOptimize(superGate, map)) {
           return considerTechMap(superGate, map);
         }
@@ -81,8 +65,9 @@ namespace eda::gate::optimizer {
   VisitorFlags TechMapVisitor::onNodeEnd(const GateID &) {
     finishTechMap();
     // Removing invalid nodes.
-    for (const auto &it: toRemove) {
-      lastCuts->erase(*it);
+    for (const auto &cut: toRemove) {
+      lastCuts->erase(std::remove(lastCuts->begin(), lastCuts->end(), cut),
+                      lastCuts->end());
     }
     toRemove.clear();
     return SUCCESS;
@@ -91,7 +76,7 @@ namespace eda::gate::optimizer {
   bool TechMapVisitor::checkValidCut(const Cut &cut) {
     for (auto node: cut) {
       if (!net->contains(node)) {
-        toRemove.emplace_back(&cut);
+        toRemove.push_back(cut);
         return false;
         // Discard trivial cuts.
       } else if (node == lastNode) {
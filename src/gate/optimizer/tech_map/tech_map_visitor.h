@@ -47,7 +47,7 @@ namespace eda::gate::optimizer {
     //std::unordered_map<GateID, double> *gatesDelay;
 
     CutStorage::Cuts *lastCuts;
-    std::vector<const CutStorage::Cut*> toRemove;
+    std::vector<CutStorage::Cut> toRemove;
 
     bool checkValidCut(const Cut &cut);
 
@@ -23,10 +23,8 @@ namespace eda::gate::optimizer {
   using GNet = eda::gate::model::GNet;
   using GateID = eda::gate::model::GNet::GateId;
   using Gate = eda::gate::model::Gate;
-  using Cut = std::unordered_set<GateID>;
+  using Cut = CutStorage::Cut;
 
   void techMap(GNet *net, int cutSize, TechMapVisitor&& techMapper, ReplacementVisitor&& replacer);
 
-  CutStorage findCuts(int cutSize, GNet *net);
-
 } // namespace eda::gate::optimizer
@@ -14,17 +14,16 @@ TTBuilder::TruthTable createMajTable(size_t inputSize,
                     const TTBuilder::TruthTableList &inputList,
                     size_t *counters) {
   TTBuilder::TruthTable result = 0;
-  size_t iterationNumber = 1u << inputSize;
   for (size_t i = 0; i < inputSize; ++i) {
-    for (size_t j = 0; j < iterationNumber; ++j) {
-      if (((inputList[i] >> j) & 1) != 0 ) {
+    for (size_t j = 0; j < 64; ++j) {
+      if (((inputList[i] >> j) & 1) != 0) {
         ++counters[j];
       }
     }
   }
-  for (size_t j = 0; j < iterationNumber; ++j) {
-    if (counters[j] > 1) {
-      result |= (1 << j);
+  for (size_t j = 0; j < 64; ++j) {
+    if (2 * counters[j] > inputSize) {
+      result |= (1ull << j);
     }
   }
   return result;
@@ -34,7 +33,7 @@ TTBuilder::TruthTable TTBuilder::applyGateFunc(const GateSymbol::Value func,
                                                const TruthTableList
                                                &inputList) {
   TruthTable result;
-  size_t counters[32] = {0};
+  size_t counters[64] = {0};
   size_t inputSize = inputList.size();
   switch (func) {
   case GateSymbol::ZERO:
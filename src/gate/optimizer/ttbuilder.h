@@ -43,10 +43,11 @@ public:
   //  1  1  1  1  1  1  a63 - 63th bit of TruthTable
   static TruthTable build(const BoundGNet &bgnet);
 
-private:
+  // Applies the gate function to the truth tables of the inputs.
   static TruthTable applyGateFunc(const GateSymbol::Value func,
                                   const TruthTableList &inputList);
 
+private:
   // Build truth table for N'th variable.
   static uint64_t buildNthVar(int n);
 };
@@ -8,6 +8,11 @@
 
 #include "gate/optimizer/util.h"
 
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
 namespace eda::gate::optimizer {
 
   void substitute(GateID cutFor, const std::unordered_map<GateID, GateID> &map, GNet *subsNet, GNet *net) {
@@ -17,16 +22,152 @@ namespace eda::gate::optimizer {
   }
 
   int fakeSubstitute(GateID cutFor, const std::unordered_map<GateID, GateID> &map, GNet *subsNet, GNet *net) {
+    // The cut leaves are referenced to bound the MFFC.
+    for (const auto &[source, leaf] : map) {
+      net->incRefs(leaf);
+    }
+
+    // The root is not removed: it is replaced by the subnet's output.
+    const int removed = static_cast<int>(derefMffc(*net, cutFor)) - 1;
 
     LinkAddCounter addCounter(net, map);
     Walker walker(subsNet, &addCounter, nullptr);
     walker.walk(true);
 
-    LinksRemoveCounter removeCounter(cutFor, addCounter.getUsed());
-    walker = Walker(net, &removeCounter, nullptr);
-    // TODO Change to found earlier cone.
-    walker.walk(cutFor, false);
-    return addCounter.getNAdded() - removeCounter.getNRemoved();
+    refMffc(*net, cutFor);
+    for (const auto &[source, leaf] : map) {
+      net->decRefs(leaf);
+    }
+
+    return addCounter.getNAdded() - removed;
+  }
+
+  unsigned fakeLevel(GateID cutFor, const std::unordered_map<GateID, GateID> &map, GNet *subsNet, GNet *net) {
+    // Subnet gate -> existing gate of the net (if any).
+    std::unordered_map<GateID, GateID> existing;
+    std::unordered_map<GateID, unsigned> levels;
+
+    const auto getLevel = [&](const Gate *gate) {
+      unsigned level = 0;
+      for (const auto input : gate->inputs()) {
+        level = std::max(level, levels[input.node()] + 1);
+      }
+      return level;
+    };
+
+    for (const auto gid : subsNet->topologicalOrder()) {
+      const auto *gate = Gate::get(gid);
+
+      if (gate->isSource()) {
+        const auto i = map.find(gid);
+        if (i != map.end()) {
+          existing[gid] = i->second;
+          levels[gid] = net->getLogicLevel(i->second);
+        } else {
+          levels[gid] = 0;
+        }
+        continue;
+      }
+
+      // The root gets the function and the inputs of the output gate.
+      const auto &links = gate->links();
+      if (links.empty() ||
+          (links.size() == 1 && Gate::get(links.front().target)->isTarget())) {
+        const auto level = getLevel(gate);
+        // The output of the net is driven by a new gate.
+        return Gate::get(cutFor)->isTarget() ? level + 1 : level;
+      }
+
+      std::vector<Gate::Signal> signals;
+      signals.reserve(gate->arity());
+      for (const auto input : gate->inputs()) {
+        const auto i = existing.find(input.node());
+        if (i == existing.end()) {
+          break;
+        }
+        signals.emplace_back(input.event(), i->second);
+      }
+
+      const auto *found = (signals.size() == gate->arity())
+          ? net->gate(gate->func(), signals) : nullptr;
+
+      if (found && found->id() != cutFor && net->contains(found->id())) {
+        existing[gid] = found->id();
+        levels[gid] = net->getLogicLevel(found->id());
+      } else {
+        levels[gid] = getLevel(gate);
+      }
+    }
+
+    return net->getLogicLevel(cutFor);
+  }
+
+  /// Checks whether the gate can be a part of an MFFC.
+  static bool isMffcGate(const GNet &net, GateID gid) {
+    if (!net.contains(gid)) {
+      return false;
+    }
+
+    const auto *gate = Gate::get(gid);
+    return !gate->isSource() && !gate->isValue() && !gate->isTrigger();
+  }
+
+  size_t derefMffc(GNet &net, GateID gid) {
+    size_t size = 1;
+    for (const auto input : Gate::get(gid)->inputs()) {
+      const auto inputId = input.node();
+      if (isMffcGate(net, inputId) && net.decRefs(inputId) == 0) {
+        size += derefMffc(net, inputId);
+      }
+    }
+    return size;
+  }
+
+  size_t refMffc(GNet &net, GateID gid) {
+    size_t size = 1;
+    for (const auto input : Gate::get(gid)->inputs()) {
+      const auto inputId = input.node();
+      if (isMffcGate(net, inputId) && net.incRefs(inputId) == 1) {
+        size += refMffc(net, inputId);
+      }
+    }
+    return size;
+  }
+
+  /// Reference counters that differ from the net ones.
+  using RefOverlay = std::vector<std::pair<GateID, unsigned>>;
+
+  static size_t countMffc(const GNet &net, GateID gid, const Cut &cut,
+                          RefOverlay &refs) {
+    size_t size = 1;
+    for (const auto input : Gate::get(gid)->inputs()) {
+      const auto inputId = input.node();
+      if (cut.find(inputId) != cut.end() || !isMffcGate(net, inputId)) {
+        continue;
+      }
+
+      auto i = std::find_if(refs.begin(), refs.end(), [inputId](auto &ref) {
+        return ref.first == inputId;
+      });
+      if (i == refs.end()) {
+        refs.push_back({inputId, net.getRefs(inputId)});
+        i = refs.end() - 1;
+      }
+
+      assert(i->second > 0);
+      if (--i->second == 0) {
+        size += countMffc(net, inputId, cut, refs);
+      }
+    }
+    return size;
+  }
+
+  size_t mffcSize(const GNet &net, GateID gid, const Cut &cut) {
+    // The cones are small: linear search is faster than hashing.
+    thread_local RefOverlay refs;
+    refs.clear();
+
+    return countMffc(net, gid, cut, refs);
   }
 
 } // namespace eda::gate::optimizer
\ No newline at end of file
@@ -12,7 +12,6 @@
 #include "gate/optimizer/cone_visitor.h"
 #include "gate/optimizer/links_add_counter.h"
 #include "gate/optimizer/links_clean.h"
-#include "gate/optimizer/links_clean_counter.h"
 #include "gate/optimizer/substitute_visitor.h"
 #include "gate/optimizer/ttbuilder.h"
 #include "gate/optimizer/walker.h"
@@ -30,7 +29,28 @@ namespace eda::gate::optimizer {
 
   void substitute(GateID cutFor, const std::unordered_map<GateID, GateID> &map, GNet *subsNet, GNet *net);
 
+  /// Estimates the change of the net size when substituting the subnet.
+  /// The gain (a negative value) is evaluated in O(size of the MFFC).
   int fakeSubstitute(GateID cutFor, const std::unordered_map<GateID, GateID> &map, GNet *subsNet, GNet *net);
 
+  /// Estimates the logic level of the gate after substituting the subnet
+  /// (the existing gates reused by the subnet keep their levels).
+  unsigned fakeLevel(GateID cutFor, const std::unordered_map<GateID, GateID> &map, GNet *subsNet, GNet *net);
+
+  /// Dereferences the maximum fanout-free cone (MFFC) of the gate and
+  /// returns its size (the gate included). The cone is bounded by the
+  /// gates whose reference counters remain positive (e.g., the referenced
+  /// cut leaves), the sources, the constants, and the triggers.
+  size_t derefMffc(GNet &net, GateID gid);
+
+  /// References the MFFC of the gate (restores the reference counters
+  /// modified by derefMffc()) and returns its size.
+  size_t refMffc(GNet &net, GateID gid);
+
+  /// Returns the size of the MFFC of the gate bounded by the cut leaves
+  /// (the gate included). The net is not modified (the function may be
+  /// called concurrently for the same net).
+  size_t mffcSize(const GNet &net, GateID gid, const Cut &cut);
+
 } // namespace eda::gate::optimizer
 
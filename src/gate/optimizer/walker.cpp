@@ -17,7 +17,8 @@ namespace eda::gate::optimizer {
 
   void Walker::walk(bool forward) {
 
-    auto nodes = eda::utils::graph::topologicalSort(*gNet);
+    // The order is maintained by the net (no sorting is required).
+    auto nodes = gNet->topologicalOrder();
     if (!forward) {
       std::reverse(nodes.begin(), nodes.end());
     }
@@ -17,20 +17,23 @@ namespace eda::gate::premapper {
 using Gate = eda::gate::model::Gate;
 using GNet = eda::gate::model::GNet;
 
-Gate::Id AigMapper::mapGate(const Gate &oldGate,
+Gate::Id AigMapper::mapGate(const GArray &array,
+                            GArray::Index i,
+                            const GateIdList &newIds,
                             const GateIdMap &oldToNewGates,
                             GNet &newNet) const {
   using GateSymbol = eda::gate::model::GateSymbol;
 
-  if (oldGate.isSource() || oldGate.isTrigger()) {
+  if (array.isSource(i) || array.isTrigger(i)) {
     // Clone sources and triggers gates w/o changes.
-    return PreMapper::mapGate(oldGate, oldToNewGates, newNet);
+    return PreMapper::mapGate(array, i, newIds, oldToNewGates, newNet);
   }
 
   size_t n0, n1;
-  auto newInputs = model::getNewInputs(oldGate, oldToNewGates, n0, n1);
+  auto newInputs =
+      model::getNewInputs(array, i, newIds, oldToNewGates, n0, n1);
 
-  switch (oldGate.func()) {
+  switch (array.func(i)) {
   case GateSymbol::IN   : return mapIn (                          newNet);
   case GateSymbol::OUT  : return mapOut(newInputs, n0, n1,        newNet);
   case GateSymbol::ZERO : return mapVal(                   false, newNet);
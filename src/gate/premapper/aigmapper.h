@@ -21,7 +21,9 @@ class AigMapper : public PreMapper, public util::Singleton<AigMapper> {
   friend class util::Singleton<AigMapper>;
 
 protected:
-  Gate::Id mapGate(const Gate &oldGate,
+  Gate::Id mapGate(const GArray &array,
+                   GArray::Index i,
+                   const GateIdList &newIds,
                    const GateIdMap &oldToNewGates,
                    GNet &newNet) const override;
 
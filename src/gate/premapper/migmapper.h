@@ -21,7 +21,9 @@ class MigMapper : public PreMapper, public util::Singleton<MigMapper> {
   friend class util::Singleton<MigMapper>;
 
 protected:
-  Gate::Id mapGate(const Gate &oldGate,
+  Gate::Id mapGate(const GArray &array,
+                   GArray::Index i,
+                   const GateIdList &newIds,
                    const GateIdMap &oldToNewGates,
                    GNet &newNet) const override;
 
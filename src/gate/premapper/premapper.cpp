@@ -56,13 +56,19 @@ GNet *PreMapper::mapGates(const GNet &net,
   auto *newNet = new GNet(net.getLevel());
 
   if (net.isFlat()) {
-    for (const auto *oldGate : net.gates()) {
-      const auto oldGateId = oldGate->id();
+    // The gates are read from the arrays in topological order; the inputs
+    // are mapped w/o looking up the hash table.
+    const GArray array(net);
+    GateIdList newIds(array.nGates(), Gate::INVALID);
+
+    for (GArray::Index i = 0; i < array.nGates(); i++) {
+      const auto oldGateId = array.id(i);
       assert(oldToNewGates.find(oldGateId) == oldToNewGates.end());
 
-      const auto newGateId = mapGate(*oldGate, oldToNewGates, *newNet);
+      const auto newGateId = mapGate(array, i, newIds, oldToNewGates, *newNet);
       assert(newGateId != Gate::INVALID);
 
+      newIds[i] = newGateId;
       oldToNewGates.emplace(oldGateId, newGateId);
     }
 
@@ -77,15 +83,18 @@ GNet *PreMapper::mapGates(const GNet &net,
   return newNet;
 }
 
-Gate::Id PreMapper::mapGate(const Gate &oldGate,
+Gate::Id PreMapper::mapGate(const GArray &array,
+                            GArray::Index i,
+                            const GateIdList &newIds,
                             const GateIdMap &oldToNewGates,
                             GNet &newNet) const {
-  if (oldGate.isSource() || oldGate.isTrigger()) {
+  if (array.isSource(i) || array.isTrigger(i)) {
     // Triggers' inputs will be connected later.
     return newNet.newGate();
   }
 
   // Just clone the given gate.
+  const auto &oldGate = *Gate::get(array.id(i));
   auto newInputs = model::getNewInputs(oldGate.inputs(), oldToNewGates);
   return newNet.addGate(oldGate.func(), newInputs);
 }
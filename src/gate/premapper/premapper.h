@@ -8,10 +8,12 @@
 
 #pragma once
 
+#include "gate/model/garray.h"
 #include "gate/model/gnet.h"
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace eda::gate::premapper {
 
@@ -23,6 +25,8 @@ class PreMapper {
 protected:
   using Gate = eda::gate::model::Gate;
   using GNet = eda::gate::model::GNet;
+  using GArray = eda::gate::model::GArray;
+  using GateIdList = std::vector<Gate::Id>;
 
 public:
   using GateIdMap = std::unordered_map<Gate::Id, Gate::Id>;
@@ -74,10 +78,14 @@ protected:
 
   GNet *mapGates(const GNet &net, GateIdMap &oldToNewGates) const;
 
-  /// Creates new gates representing the given one and adds them to the net.
-  /// Returns the identifier of the new gate corresponding to the old one or
+  /// Creates new gates representing the i-th gate of the array and adds
+  /// them to the net. The new gates of the array's gates preceding the
+  /// i-th one are in newIds; the other ones are in oldToNewGates. Returns
+  /// the identifier of the new gate corresponding to the old one or
   /// Gate::INVALID if the operation fails.
-  virtual Gate::Id mapGate(const Gate &oldGate,
+  virtual Gate::Id mapGate(const GArray &array,
+                           GArray::Index i,
+                           const GateIdList &newIds,
                            const GateIdMap &oldToNewGates,
                            GNet &newNet) const;
 };
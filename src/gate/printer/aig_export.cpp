@@ -0,0 +1,231 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/model/garray.h"
+#include "gate/printer/aig_export.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace eda::gate::printer {
+
+using GArray = model::GArray;
+using GateSymbol = model::GateSymbol;
+using GNet = model::GNet;
+
+namespace {
+
+/**
+ * \brief Decomposes the gates of a net into two-input ANDs.
+ *
+ * The nodes are referred to by the AIGER literals: 2 * var + negation,
+ * where 0 and 1 are the constants, 1..I are the inputs, and I+1..M are
+ * the ANDs (in the order of creation). The translation is deterministic,
+ * so it can be repeated to get the same numbering.
+ */
+class AigTranslator final {
+public:
+  using Lit = std::uint32_t;
+
+  explicit AigTranslator(const GNet &net): array(net), lits(array.nGates()) {
+    for (GArray::Index i = 0; i < array.nGates(); i++) {
+      if (array.func(i) == GateSymbol::IN) {
+        inputs.push_back(i);
+      } else if (array.func(i) == GateSymbol::OUT) {
+        outputs.push_back(i);
+      }
+    }
+  }
+
+  /// Translates the net calling sink(lhs, rhs0, rhs1) for every AND
+  /// (returns false if there is an unsupported gate).
+  template <typename Sink>
+  bool run(Sink &&sink) {
+    nextVar = static_cast<Lit>(inputs.size() + 1);
+    for (std::size_t k = 0; k < inputs.size(); k++) {
+      lits[inputs[k]] = static_cast<Lit>(2 * (k + 1));
+    }
+
+    const auto addAnd = [this, &sink](Lit x, Lit y) -> Lit {
+      if (x == 0 || y == 0 || x == (y ^ 1)) return 0;
+      if (x == 1 || x == y) return y;
+      if (y == 1) return x;
+
+      const Lit lhs = 2 * nextVar++;
+      sink(lhs, std::max(x, y), std::min(x, y));
+      return lhs;
+    };
+    const auto addOr = [&addAnd](Lit x, Lit y) -> Lit {
+      return addAnd(x ^ 1, y ^ 1) ^ 1;
+    };
+    const auto addXor = [&addAnd, &addOr](Lit x, Lit y) -> Lit {
+      return addOr(addAnd(x, y ^ 1), addAnd(x ^ 1, y));
+    };
+
+    for (GArray::Index i = 0; i < array.nGates(); i++) {
+      const auto func = array.func(i);
+      const auto arity = array.arity(i);
+
+      if (func == GateSymbol::IN) continue;
+
+      std::vector<Lit> in(arity);
+      for (std::size_t j = 0; j < arity; j++) {
+        const auto k = array.fanin(i, j);
+        if (k == GArray::EXTERNAL) return false;
+        in[j] = lits[k];
+      }
+
+      Lit result;
+      switch (func) {
+      case GateSymbol::ZERO:
+        result = 0;
+        break;
+      case GateSymbol::ONE:
+        result = 1;
+        break;
+      case GateSymbol::OUT:
+      case GateSymbol::NOP:
+        result = in[0];
+        break;
+      case GateSymbol::NOT:
+        result = in[0] ^ 1;
+        break;
+      case GateSymbol::AND:
+      case GateSymbol::NAND:
+        result = 1;
+        for (const auto x : in) result = addAnd(result, x);
+        result ^= (func == GateSymbol::NAND);
+        break;
+      case GateSymbol::OR:
+      case GateSymbol::NOR:
+        result = 0;
+        for (const auto x : in) result = addOr(result, x);
+        result ^= (func == GateSymbol::NOR);
+        break;
+      case GateSymbol::XOR:
+      case GateSymbol::XNOR:
+        result = 0;
+        for (const auto x : in) result = addXor(result, x);
+        result ^= (func == GateSymbol::XNOR);
+        break;
+      case GateSymbol::MAJ:
+        if (arity != 3) return false;
+        // maj(x, y, z) = (x & y) | (z & (x | y)).
+        result = addOr(addAnd(in[0], in[1]), addAnd(in[2], addOr(in[0], in[1])));
+        break;
+      default:
+        return false;
+      }
+
+      lits[i] = result;
+    }
+
+    return true;
+  }
+
+  /// Returns the maximum variable index (after run).
+  Lit maxVar() const { return nextVar - 1; }
+
+  /// Returns the literal of the i-th gate (after run).
+  Lit lit(GArray::Index i) const { return lits[i]; }
+
+  const GArray array;
+
+  std::vector<GArray::Index> inputs;
+  std::vector<GArray::Index> outputs;
+
+private:
+  std::vector<Lit> lits;
+  Lit nextVar = 0;
+};
+
+/// Writes the unsigned integer in the 7-bit variable-length encoding.
+void writeVarint(std::ostream &out, std::uint32_t x) {
+  while (x & ~0x7fu) {
+    out.put(static_cast<char>((x & 0x7f) | 0x80));
+    x >>= 7;
+  }
+  out.put(static_cast<char>(x));
+}
+
+} // namespace
+
+bool writeAiger(std::ostream &out, const GNet &net) {
+  assert(net.isSorted());
+
+  AigTranslator translator(net);
+
+  // Count the ANDs.
+  std::size_t nAnds = 0;
+  if (!translator.run([&nAnds](auto, auto, auto) { nAnds++; })) {
+    return false;
+  }
+
+  out << "aig " << translator.maxVar()
+      << " " << translator.inputs.size()
+      << " 0"
+      << " " << translator.outputs.size()
+      << " " << nAnds << "\n";
+
+  for (const auto i : translator.outputs) {
+    out << translator.lit(i) << "\n";
+  }
+
+  // Write the ANDs (lhs > rhs0 >= rhs1) as the deltas.
+  translator.run([&out](auto lhs, auto rhs0, auto rhs1) {
+    writeVarint(out, lhs - rhs0);
+    writeVarint(out, rhs0 - rhs1);
+  });
+
+  return true;
+}
+
+bool writeDimacs(std::ostream &out, const GNet &net) {
+  assert(net.isSorted());
+
+  AigTranslator translator(net);
+
+  std::size_t nAnds = 0;
+  if (!translator.run([&nAnds](auto, auto, auto) { nAnds++; })) {
+    return false;
+  }
+
+  // The last variable is constant zero.
+  const auto zero = static_cast<long>(translator.maxVar()) + 1;
+  const auto dimacs = [zero](AigTranslator::Lit lit) -> long {
+    const auto var = (lit >> 1) ? static_cast<long>(lit >> 1) : zero;
+    return (lit & 1) ? -var : var;
+  };
+
+  for (std::size_t k = 0; k < translator.inputs.size(); k++) {
+    const auto id = translator.array.id(translator.inputs[k]);
+    out << "c input " << id << " " << (k + 1) << "\n";
+  }
+
+  // Clauses: 3 per AND, the zero unit, and the outputs disjunction.
+  out << "p cnf " << zero << " " << (3 * nAnds + 2) << "\n";
+  out << -zero << " 0\n";
+
+  translator.run([&out, &dimacs](auto lhs, auto rhs0, auto rhs1) {
+    const auto y = dimacs(lhs), x1 = dimacs(rhs0), x2 = dimacs(rhs1);
+    out << -y << " " << x1 << " 0\n";
+    out << -y << " " << x2 << " 0\n";
+    out << y << " " << -x1 << " " << -x2 << " 0\n";
+  });
+
+  for (const auto i : translator.outputs) {
+    out << dimacs(translator.lit(i)) << " ";
+  }
+  out << "0\n";
+
+  return true;
+}
+
+} // namespace eda::gate::printer
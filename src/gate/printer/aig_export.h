@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "gate/model/gnet.h"
+
+#include <ostream>
+
+namespace eda::gate::printer {
+
+/**
+ * \brief Writes a combinational net in the binary AIGER format.
+ *
+ * The net (typically, an AIG/XAG after premapping or a miter) should be
+ * topologically sorted. The non-AND gates are decomposed into ANDs on the
+ * fly: the net is traversed twice (to count the ANDs for the header and
+ * to write them), so no intermediate AIG is built. The inputs and the
+ * outputs are written in the order of GNet::gates().
+ *
+ * @return false if the net contains gates w/o an AIG decomposition
+ * (e.g., triggers); nothing is written in this case.
+ */
+bool writeAiger(std::ostream &out, const model::GNet &net);
+
+/**
+ * \brief Writes the CNF of a combinational net in the DIMACS format.
+ *
+ * The net is decomposed into ANDs as in writeAiger and Tseitin-encoded
+ * (the DIMACS variable of an AIG node is its AIGER variable; the extra
+ * last variable stands for constant zero). The disjunction of the outputs
+ * is asserted, so the CNF of a miter is satisfiable iff the nets are not
+ * equivalent. The input variables are listed in the comments.
+ *
+ * @return false if the net contains gates w/o an AIG decomposition.
+ */
+bool writeDimacs(std::ostream &out, const model::GNet &net);
+
+} // namespace eda::gate::printer
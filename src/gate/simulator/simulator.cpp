@@ -9,63 +9,242 @@
 #include "gate/simulator/simulator.h"
 #include "util/assert.h"
 
+#include <algorithm>
+
 namespace eda::gate::simulator {
 
 using Compiled = Simulator::Compiled;
 
-Compiled::OP Compiled::getOp(const Gate &gate) const {
-  using GateSymbol = eda::gate::model::GateSymbol;
-
-  const auto n = gate.arity();
-
-  switch (gate.func()) {
-  case GateSymbol::OUT   : return getNop(n);
-  case GateSymbol::ZERO  : return getZero(n);
-  case GateSymbol::ONE   : return getOne(n);
-  case GateSymbol::NOP   : return getNop(n);
-  case GateSymbol::NOT   : return getNot(n);
-  case GateSymbol::AND   : return getAnd(n);
-  case GateSymbol::OR    : return getOr(n);
-  case GateSymbol::XOR   : return getXor(n);
-  case GateSymbol::NAND  : return getNand(n);
-  case GateSymbol::NOR   : return getNor(n);
-  case GateSymbol::XNOR  : return getXnor(n);
-  case GateSymbol::MAJ   : return getMaj(n);
-  case GateSymbol::LATCH : return getLatch(n);
-  case GateSymbol::DFF   : return getDff(n);
-  case GateSymbol::DFFrs : return getDffrs(n);
-  default: uassert(false, "Unsupported gate: " << gate.func() << std::endl);
+Compiled::Opcode Compiled::getOp(GateSymbol func, I n) {
+  // Selects the specialized operation for the gate arity.
+  const auto select = [n](Opcode op1, Opcode op2, Opcode op3, Opcode opN) {
+    switch (n) {
+    case  1: return op1;
+    case  2: return op2;
+    case  3: return op3;
+    default: return opN;
+    }
+  };
+
+  switch (func) {
+  case GateSymbol::OUT   : return NOP;
+  case GateSymbol::ZERO  : return ZERO;
+  case GateSymbol::ONE   : return ONE;
+  case GateSymbol::NOP   : return NOP;
+  case GateSymbol::NOT   : return NOT;
+  case GateSymbol::AND   : return select(NOP, AND2,  AND3,  ANDN);
+  case GateSymbol::OR    : return select(NOP, OR2,   OR3,   ORN);
+  case GateSymbol::XOR   : return select(NOP, XOR2,  XOR3,  XORN);
+  case GateSymbol::NAND  : return select(NOT, NAND2, NAND3, NANDN);
+  case GateSymbol::NOR   : return select(NOT, NOR2,  NOR3,  NORN);
+  case GateSymbol::XNOR  : return select(NOT, XNOR2, XNOR3, XNORN);
+  case GateSymbol::MAJ   : return select(NOP, MAJN,  MAJ3,  MAJN);
+  case GateSymbol::LATCH : return LATCH;
+  case GateSymbol::DFF   : return DFF;
+  case GateSymbol::DFFrs : return DFFRS;
+  default: uassert(false, "Unsupported gate: " << func << std::endl);
   }
 
-  return getZero(0);
+  return ZERO;
 }
 
-Compiled::Command Compiled::getCommand(const GNet &net,
-                                       const Gate &gate) const {
-  const auto op = getOp(gate);
+void Compiled::addCommand(const GArray &array, GArray::Index i,
+                          const IV &cells) {
+  const auto target = array.id(i);
+  const auto arity = array.arity(i);
 
-  const auto target = gate.id();
-  Gate::Link outLink(target);
-  const auto out = gindex.find(outLink)->second;
+  Command command;
+  command.op = getOp(array.func(i), arity);
+  command.n = arity;
+  command.out = cells[i];
+  command.in = args.size();
 
-  IV in(gate.arity());
-  for (I i = 0; i < gate.arity(); i++) {
-    const auto source = gate.input(i).node();
+  for (I k = 0; k < arity; k++) {
+    const auto j = array.fanin(i, k);
 
-    Gate::Link inLink = net.contains(source)
-                      ? Gate::Link(source)
-                      : Gate::Link(source, target, i);
+    if (j == GArray::EXTERNAL) {
+      Gate::Link inLink(array.faninId(i, k), target, k);
+      args.push_back(gindex.find(inLink)->second);
+    } else if (array.isSource(j)) {
+      Gate::Link inLink(array.id(j));
+      args.push_back(gindex.find(inLink)->second);
+    } else {
+      args.push_back(cells[j]);
+    }
+  }
+
+  program.push_back(command);
+}
 
-    in[i] = gindex.find(inLink)->second;
+Compiled::W Compiled::maj(const std::uint32_t *in, std::uint32_t n) const {
+  // Bit-sliced counters: the i-th word holds the i-th bits of the
+  // numbers of ones in the patterns.
+  W count[32] = {0};
+  I width = 0;
+
+  for (std::uint32_t i = 0; i < n; i++) {
+    W carry = memory[in[i]];
+    for (I j = 0; carry != 0; j++) {
+      const W next = count[j] & carry;
+      count[j] ^= carry;
+      carry = next;
+      width = std::max(width, j + 1);
+    }
+  }
+
+  // Compare the counters with the threshold: count > (n / 2).
+  const I k = (n >> 1);
+  W greater = 0;
+  W equal = ~0ull;
+  for (I j = std::max(width, I(1)); j > 0; j--) {
+    if ((k >> (j - 1)) & 1) {
+      equal &= count[j - 1];
+    } else {
+      greater |= equal & count[j - 1];
+      equal &= ~count[j - 1];
+    }
   }
 
-  return Command{op, out, in};
+  // Threshold bits above the counters' width.
+  return (k >> width) != 0 ? 0 : greater;
+}
+
+void Compiled::execute() {
+  W *m = memory.data();
+  const std::uint32_t *a = args.data();
+
+  for (const auto &command : program) {
+    const auto *in = a + command.in;
+    const auto out = command.out;
+    const auto n = command.n;
+
+    switch (command.op) {
+    case ZERO:
+      m[out] = 0;
+      break;
+    case ONE:
+      m[out] = ~0ull;
+      break;
+    case NOP:
+      m[out] = m[in[0]];
+      break;
+    case NOT:
+      m[out] = ~m[in[0]];
+      break;
+    case AND2:
+      m[out] = m[in[0]] & m[in[1]];
+      break;
+    case AND3:
+      m[out] = m[in[0]] & m[in[1]] & m[in[2]];
+      break;
+    case ANDN: {
+      W result = ~0ull;
+      for (std::uint32_t i = 0; i < n; i++) result &= m[in[i]];
+      m[out] = result;
+      break;
+    }
+    case OR2:
+      m[out] = m[in[0]] | m[in[1]];
+      break;
+    case OR3:
+      m[out] = m[in[0]] | m[in[1]] | m[in[2]];
+      break;
+    case ORN: {
+      W result = 0;
+      for (std::uint32_t i = 0; i < n; i++) result |= m[in[i]];
+      m[out] = result;
+      break;
+    }
+    case XOR2:
+      m[out] = m[in[0]] ^ m[in[1]];
+      break;
+    case XOR3:
+      m[out] = m[in[0]] ^ m[in[1]] ^ m[in[2]];
+      break;
+    case XORN: {
+      W result = 0;
+      for (std::uint32_t i = 0; i < n; i++) result ^= m[in[i]];
+      m[out] = result;
+      break;
+    }
+    case NAND2:
+      m[out] = ~(m[in[0]] & m[in[1]]);
+      break;
+    case NAND3:
+      m[out] = ~(m[in[0]] & m[in[1]] & m[in[2]]);
+      break;
+    case NANDN: {
+      W result = ~0ull;
+      for (std::uint32_t i = 0; i < n; i++) result &= m[in[i]];
+      m[out] = ~result;
+      break;
+    }
+    case NOR2:
+      m[out] = ~(m[in[0]] | m[in[1]]);
+      break;
+    case NOR3:
+      m[out] = ~(m[in[0]] | m[in[1]] | m[in[2]]);
+      break;
+    case NORN: {
+      W result = 0;
+      for (std::uint32_t i = 0; i < n; i++) result |= m[in[i]];
+      m[out] = ~result;
+      break;
+    }
+    case XNOR2:
+      m[out] = ~(m[in[0]] ^ m[in[1]]);
+      break;
+    case XNOR3:
+      m[out] = ~(m[in[0]] ^ m[in[1]] ^ m[in[2]]);
+      break;
+    case XNORN: {
+      W result = ~0ull;
+      for (std::uint32_t i = 0; i < n; i++) result ^= m[in[i]];
+      m[out] = result;
+      break;
+    }
+    case MAJ3: {
+      const W x = m[in[0]];
+      const W y = m[in[1]];
+      const W z = m[in[2]];
+      m[out] = (x & y) | (x & z) | (y & z);
+      break;
+    }
+    case MAJN:
+      m[out] = maj(in, n);
+      break;
+    case LATCH: {
+      const W ena = m[in[1]];
+      const W d = m[in[0]];
+      postponed[nPostponed++] = {out, (ena & d) | (~ena & m[out])};
+      break;
+    }
+    case DFF: {
+      // TODO: posedge(clk).
+      const W clk = m[in[1]];
+      const W d = m[in[0]];
+      postponed[nPostponed++] = {out, (clk & d) | (~clk & m[out])};
+      break;
+    }
+    case DFFRS: {
+      // TODO: posedge(clk).
+      const W clk = m[in[1]];
+      const W rst = m[in[2]];
+      const W set = m[in[3]];
+      const W d = m[in[0]];
+      assert(!(rst & set));
+
+      const W q = (clk & d) | (~clk & m[out]);
+      postponed[nPostponed++] = {out, ~rst & (set | q)};
+      break;
+    }
+    }
+  }
 }
 
 Compiled::Compiled(const GNet &net,
                    const GNet::LinkList &in,
                    const GNet::LinkList &out):
-    program(net.nGates()),
     nInputs(in.size()),
     outputs(out.size()),
     memory(net.nSourceLinks() + net.nGates()),
@@ -75,34 +254,38 @@ Compiled::Compiled(const GNet &net,
   assert(net.isSorted() && "Net is not topologically sorted");
   assert(net.nSourceLinks() == in.size());
 
-  gindex.reserve(net.nSourceLinks() + net.nGates());
+  const GArray array(net);
 
   // Map the source links (including source gates) to memory.
+  gindex.reserve(in.size());
+
   I i = 0;
   for (const auto link : in) {
     gindex[link] = i++;
   }
 
   // Map the non-source gates to memory.
-  for (const auto *gate : net.gates()) {
-    if (gate->isSource()) continue;
-    Gate::Link link(gate->id());
-    gindex[link] = i++;
+  IV cells(array.nGates());
+  for (GArray::Index j = 0; j < array.nGates(); j++) {
+    if (array.isSource(j)) continue;
+    cells[j] = i++;
   }
 
   // Determine the output indices.
   i = 0;
   for (const auto link : out) {
-    outputs[i++] = gindex[link];
+    const auto j = link.isPort() ? array.index(link.source) : GArray::EXTERNAL;
+    const bool isGate = j != GArray::EXTERNAL && !array.isSource(j);
+    outputs[i++] = isGate ? cells[j] : gindex[link];
   }
 
   // Compose the simulation program.
-  i = 0;
-  for (const auto *gate : net.gates()) {
-    if (gate->isSource()) continue;
-    program[i++] = getCommand(net, *gate);
+  program.reserve(array.nGates());
+  args.reserve(net.nConnects() + net.nSourceLinks());
+  for (GArray::Index j = 0; j < array.nGates(); j++) {
+    if (array.isSource(j)) continue;
+    addCommand(array, j, cells);
   }
-  program.resize(i);
 }
 
 } // namespace eda::gate::simulator
@@ -8,10 +8,11 @@
 
 #pragma once
 
+#include "gate/model/garray.h"
 #include "gate/model/gnet.h"
 
 #include <cassert>
-#include <functional>
+#include <cstdint>
 #include <vector>
 
 namespace eda::gate::simulator {
@@ -21,7 +22,9 @@ namespace eda::gate::simulator {
  * \author <a href="mailto:kamkin@ispras.ru">Alexander Kamkin</a>
  */
 class Simulator final {
+  using GArray = eda::gate::model::GArray;
   using Gate = eda::gate::model::Gate;
+  using GateSymbol = eda::gate::model::GateSymbol;
   using GNet = eda::gate::model::GNet;
 
 public:
@@ -38,6 +41,11 @@ public:
     using BV = std::vector<B>;
     using I  = std::size_t;
     using IV = std::vector<I>;
+    using W  = std::uint64_t;
+    using WV = std::vector<W>;
+
+    /// Number of patterns simulated in parallel (bits per word).
+    static constexpr I WIDTH = 64;
 
     /// Returns the number of inputs.
     I nSources() const { return nInputs; }
@@ -45,6 +53,10 @@ public:
     I nTargets() const { return outputs.size(); }
 
     /// Evaluates the outputs from the inputs.
+    ///
+    /// If T is WV, the values are bit-parallel: the j-th bit of in[i]
+    /// (out[i]) is the value of the i-th input (output) for the j-th
+    /// pattern, so that WIDTH patterns are evaluated in a single pass.
     template <typename T = BV>
     void simulate(T &out, const T &in) { 
       setTriggers();
@@ -53,12 +65,29 @@ public:
       getTargets(out);
     }
 
+    /// Returns the word of the given input for the given block of the
+    /// exhaustive enumeration (the input combinations are enumerated in
+    /// blocks of WIDTH patterns: pattern j of block b is b * WIDTH + j).
+    static W exhaustive(I input, std::uint64_t block) {
+      static constexpr W masks[] = {
+        0xaaaaaaaaaaaaaaaaull,
+        0xccccccccccccccccull,
+        0xf0f0f0f0f0f0f0f0ull,
+        0xff00ff00ff00ff00ull,
+        0xffff0000ffff0000ull,
+        0xffffffff00000000ull
+      };
+
+      return input < 6 ? masks[input]
+                       : (((block >> (input - 6)) & 1) ? ~0ull : 0ull);
+    }
+
   private:
     /// Sets the input values.
     void setSources(const BV &values) {
       assert(values.size() == nInputs);
       for (I i = 0; i < nInputs; i++) {
-        memory[i] = values[i];
+        memory[i] = values[i] ? ~0ull : 0ull;
       }
     }
 
@@ -66,7 +95,15 @@ public:
     void setSources(std::uint64_t values) {
       assert(nInputs <= 64);
       for (I i = 0; i < nInputs; i++) {
-        memory[i] = (values >> i) & 1;
+        memory[i] = ((values >> i) & 1) ? ~0ull : 0ull;
+      }
+    }
+
+    /// Sets the input values (bit-parallel).
+    void setSources(const WV &values) {
+      assert(values.size() == nInputs);
+      for (I i = 0; i < nInputs; i++) {
+        memory[i] = values[i];
       }
     }
 
@@ -85,7 +122,7 @@ public:
     void getTargets(BV &values) {
       assert(values.size() == outputs.size());
       for (I i = 0; i < outputs.size(); i++) {
-        values[i] = memory[outputs[i]];
+        values[i] = memory[outputs[i]] & 1;
       }
     }
 
@@ -94,349 +131,89 @@ public:
       assert(outputs.size() <= 64);
       values = 0;
       for (I i = 0; i < outputs.size(); i++) {
-        values |= (memory[outputs[i]] << i);
+        values |= ((memory[outputs[i]] & 1) << i);
       }
     }
 
-    /// Executes the compiled program.
-    void execute() {
-      for (auto &command : program) {
-        command.op(command.out, command.in);
+    /// Gets the output values (bit-parallel).
+    void getTargets(WV &values) {
+      assert(values.size() == outputs.size());
+      for (I i = 0; i < outputs.size(); i++) {
+        values[i] = memory[outputs[i]];
       }
     }
 
-    /// Gate function (operation).
-    using OP = std::function<void(I, IV)>;
-
-    /// Single command.
+    /// Executes the compiled program.
+    void execute();
+
+    /// Operation code.
+    enum Opcode : std::uint8_t {
+      ZERO,
+      ONE,
+      NOP,
+      NOT,
+      AND2,
+      AND3,
+      ANDN,
+      OR2,
+      OR3,
+      ORN,
+      XOR2,
+      XOR3,
+      XORN,
+      NAND2,
+      NAND3,
+      NANDN,
+      NOR2,
+      NOR3,
+      NORN,
+      XNOR2,
+      XNOR3,
+      XNORN,
+      MAJ3,
+      MAJN,
+      LATCH,
+      DFF,
+      DFFRS
+    };
+
+    /// Single command (instruction of the compiled program).
     struct Command final {
-      OP op;  // Operation.
-      I  out; // Output.
-      IV in;  // Inputs.
+      Opcode op;          // Operation.
+      std::uint32_t n;    // Number of inputs.
+      std::uint32_t out;  // Output (index in memory).
+      std::uint32_t in;   // Inputs (offset in the argument buffer).
     };
 
-    /// Returns the gate function.
-    OP getOp(const Gate &gate) const;
-    /// Construct the command for the given gate.
-    Command getCommand(const GNet &net, const Gate &gate) const;
+    /// Returns the operation code for the gate.
+    static Opcode getOp(GateSymbol func, I arity);
+    /// Appends the command for the i-th gate to the program
+    /// (cells map the gate indices to memory indices).
+    void addCommand(const GArray &array, GArray::Index i, const IV &cells);
+
+    /// Returns the majority of the given values.
+    W maj(const std::uint32_t *in, std::uint32_t n) const;
 
     /// Compiled program for the given net.
     std::vector<Command> program;
+    /// Arguments of the commands: indices in memory (see below).
+    std::vector<std::uint32_t> args;
     /// Number of the program inputs.
     I nInputs;
     /// Program outputs: indices in memory (see below).
     IV outputs;
 
     /// Holds the state: first, inputs; then, internal gates.
-    BV memory;
+    /// Each cell stores the gate values for WIDTH patterns.
+    WV memory;
 
     /// Postponed assignments (for triggers).
-    std::vector<std::pair<I, B>> postponed;
+    std::vector<std::pair<I, W>> postponed;
     /// Number of postponed assignments.
     I nPostponed;
 
-    /// Maps source links and gates to memory indices.
+    /// Maps source links to memory indices.
     std::unordered_map<Gate::Link, I> gindex;
-
-    //------------------------------------------------------------------------//
-    // ZERO
-    //------------------------------------------------------------------------//
-
-    const OP opZero = [this](I out, IV in) {
-      memory[out] = 0;
-    };
-
-    OP getZero(I arity) const { return opZero; }
-
-    //------------------------------------------------------------------------//
-    // ONE
-    //------------------------------------------------------------------------//
-
-    const OP opOne = [this](I out, IV in) {
-      memory[out] = 1;
-    };
-
-    OP getOne(I arity) const { return opOne; }
-
-    //------------------------------------------------------------------------//
-    // NOP
-    //------------------------------------------------------------------------//
-
-    const OP opNop = [this](I out, IV in) {
-      memory[out] = memory[in[0]];
-    };
-
-    OP getNop(I arity) const { return opNop; }
-
-    //------------------------------------------------------------------------//
-    // NOT
-    //------------------------------------------------------------------------//
-
-    const OP opNot = [this](I out, IV in) {
-      memory[out] = !memory[in[0]];
-    };
-
-    OP getNot(I arity) const { return opNot; }
-
-    //------------------------------------------------------------------------//
-    // AND
-    //------------------------------------------------------------------------//
-
-    const OP opAnd2 = [this](I out, IV in) {
-      memory[out] = memory[in[0]] && memory[in[1]];
-    };
-
-    const OP opAnd3 = [this](I out, IV in) {
-      memory[out] = memory[in[0]] && memory[in[1]] && memory[in[2]];
-    };
-
-    const OP opAndN = [this](I out, IV in) {
-      for (auto i : in) {
-        if (!memory[i]) {
-          memory[out] = 0;
-          return;
-        }
-      }
-      memory[out] = 1;
-    };
-
-    OP getAnd(I arity) const {
-      switch (arity) {
-      case  1: return opNop;
-      case  2: return opAnd2;
-      case  3: return opAnd3;
-      default: return opAndN;
-      }
-    }
-
-    //------------------------------------------------------------------------//
-    // OR
-    //------------------------------------------------------------------------//
-
-    const OP opOr2 = [this](I out, IV in) {
-      memory[out] = memory[in[0]] || memory[in[1]];
-    };
-
-    const OP opOr3 = [this](I out, IV in) {
-      memory[out] = memory[in[0]] || memory[in[1]] || memory[in[2]];
-    };
-
-    const OP opOrN = [this](I out, IV in) {
-      for (auto i : in) {
-        if (memory[i]) {
-          memory[out] = 1;
-          return;
-        }
-      }
-      memory[out] = 0;
-    };
-
-    OP getOr(I arity) const {
-      switch (arity) {
-      case  1: return opNop;
-      case  2: return opOr2;
-      case  3: return opOr3;
-      default: return opOrN;
-      }
-    }
-
-    //------------------------------------------------------------------------//
-    // XOR
-    //------------------------------------------------------------------------//
-
-    const OP opXor2 = [this](I out, IV in) {
-      memory[out] = memory[in[0]] ^ memory[in[1]];
-    };
-
-    const OP opXor3 = [this](I out, IV in) {
-      memory[out] = memory[in[0]] ^ memory[in[1]] ^ memory[in[2]];
-    };
-
-    const OP opXorN = [this](I out, IV in) {
-      bool result = 0;
-      for (auto i : in) {
-        result ^= memory[i];
-      }
-      memory[out] = result;
-    };
-
-    OP getXor(I arity) const {
-      switch (arity) {
-      case  1: return opNop;
-      case  2: return opXor2;
-      case  3: return opXor3;
-      default: return opXorN;
-      }
-    }
-
-    //------------------------------------------------------------------------//
-    // NAND
-    //------------------------------------------------------------------------//
-
-    const OP opNand2 = [this](I out, IV in) {
-      memory[out] = !(memory[in[0]] && memory[in[1]]);
-    };
-
-    const OP opNand3 = [this](I out, IV in) {
-      memory[out] = !(memory[in[0]] && memory[in[1]] && memory[in[2]]);
-    };
-
-    const OP opNandN = [this](I out, IV in) {
-      for (auto i : in) {
-        if (!memory[i]) {
-          memory[out] = 1;
-          return;
-        }
-      }
-      memory[out] = 0;
-    };
-
-    OP getNand(I arity) const {
-      switch (arity) {
-      case  1: return opNot;
-      case  2: return opNand2;
-      case  3: return opNand3;
-      default: return opNandN;
-      }
-    }
-
-    //------------------------------------------------------------------------//
-    // NOR
-    //------------------------------------------------------------------------//
-
-    const OP opNor2 = [this](I out, IV in) {
-      memory[out] = !(memory[in[0]] || memory[in[1]]);
-    };
-
-    const OP opNor3 = [this](I out, IV in) {
-      memory[out] = !(memory[in[0]] || memory[in[1]] || memory[in[2]]);
-    };
-
-    const OP opNorN = [this](I out, IV in) {
-      for (auto i : in) {
-        if (memory[i]) {
-          memory[out] = 0;
-          return;
-        }
-      }
-      memory[out] = 1;
-    };
-
-    OP getNor(I arity) const {
-      switch (arity) {
-      case  1: return opNot;
-      case  2: return opNor2;
-      case  3: return opNor3;
-      default: return opNorN;
-      }
-    }
-
-    //------------------------------------------------------------------------//
-    // XNOR
-    //------------------------------------------------------------------------//
-
-    const OP opXnor2 = [this](I out, IV in) {
-      memory[out] = memory[in[0]] == memory[in[1]];
-    };
-
-    const OP opXnor3 = [this](I out, IV in) {
-      memory[out] = !(memory[in[0]] ^ memory[in[1]] ^ memory[in[2]]);
-    };
-
-    const OP opXnorN = [this](I out, IV in) {
-      bool result = 1;
-      for (auto i : in) {
-        result ^= memory[i];
-      }
-      memory[out] = result;
-    };
-
-    OP getXnor(I arity) const {
-      switch (arity) {
-      case  1: return opNot;
-      case  2: return opXnor2;
-      case  3: return opXnor3;
-      default: return opXnorN;
-      }
-    }
-
-    //------------------------------------------------------------------------//
-    // MAJ
-    //------------------------------------------------------------------------//
-
-    const OP opMaj3 = [this](I out, IV in) {
-      memory[out] = (memory[in[0]] + memory[in[1]] + memory[in[2]]) >= 2;
-    };
-
-    const OP opMajN = [this](I out, IV in) {
-      const size_t n = in.size();
-      const size_t k = (n >> 1);
-
-      unsigned w = memory[in[n - 1]];
-      for (size_t i = 0; i < k; i++) {
-        w += memory[in[(i << 1)]];
-        w += memory[in[(i << 1)|1]];
-      }
-
-      memory[out] = (w > k);
-    };
-
-    OP getMaj(I arity) const {
-      switch (arity) {
-      case  1: return opNop;
-      case  3: return opMaj3;
-      default: return opMajN;
-      }
-    }
-
-    //------------------------------------------------------------------------//
-    // LATCH
-    //------------------------------------------------------------------------//
-
-    const OP opLatch = [this](I out, IV in) {
-      const bool ena = memory[in[1]];
-      if (ena) {
-        postponed[nPostponed++] = {out, memory[in[0]]};
-      }
-    };
-
-    OP getLatch(I arity) const { return opLatch; }
-
-    //------------------------------------------------------------------------//
-    // DFF
-    //------------------------------------------------------------------------//
-
-    const OP opDff = [this](I out, IV in) {
-      // TODO: posedge(clk).
-      const bool clk = memory[in[1]];
-      if (clk) {
-        postponed[nPostponed++] = {out, memory[in[0]]};
-      }
-    };
-
-    OP getDff(I arity) const { return opDff; }
-
-    //------------------------------------------------------------------------//
-    // DFFrs
-    //------------------------------------------------------------------------//
-
-    const OP opDffrs = [this](I out, IV in) {
-      // TODO: posedge(clk).
-      const bool clk = memory[in[1]];
-      const bool rst = memory[in[2]];
-      const bool set = memory[in[3]];
-      assert(!(rst && set));
-
-      if (rst) {
-        postponed[nPostponed++] = {out, 0};
-      } else if (set) {
-        postponed[nPostponed++] = {out, 1};
-      } else if (clk) {
-        postponed[nPostponed++] = {out, memory[in[0]]};
-      }
-    };
-
-    OP getDffrs(I arity) const { return opDffrs; }
   };
 
   /// Compiles the given net.
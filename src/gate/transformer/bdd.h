@@ -45,12 +45,10 @@ public:
                           GateBDDMap &varMap, 
                           const Cudd &manager);
 
-private:
   // Apply gate function to BDD list. Returns result BDD.
   static BDD applyGateFunc(const GateSymbol::Value func, 
                            const BDDList &inputList, 
                            const Cudd &manager);
-
 };
 
 } // namespace eda::gate::transformer
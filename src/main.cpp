@@ -7,6 +7,8 @@
 //===----------------------------------------------------------------------===//
 #include "config.h"
 #include "gate/model/gate.h"
+#include "gate/optimizer/rwdatabase.h"
+#include "gate/optimizer/rwmanager.h"
 #include "tool/rtl_context.h"
 #include "util/string.h"
 
@@ -42,16 +44,40 @@ int main(int argc, char **argv) {
     return options.exit(e);
   }
 
+  if (!options.rwdb.inSqlite.empty() && !options.rwdb.outBin.empty()) {
+    try {
+      eda::gate::optimizer::BinaryRWDatabase::convert(options.rwdb.inSqlite,
+                                                      options.rwdb.outBin);
+    } catch (const char *msg) {
+      std::cerr << msg << std::endl;
+      return -1;
+    }
+  }
+
+  if (!options.rwdb.inBin.empty()) {
+    eda::gate::optimizer::RewriteManager::get().setBinary(options.rwdb.inBin);
+  }
+
   int result = 0;
   std::string nameFileLibrary;
 
+  // The Liberty file is parsed once (in its own gate store); the library
+  // database is refilled from the parsed cells in each design's store.
+  eda::gate::model::GateStore libraryStore;
+  NetData libraryData;
+
   if (!options.rtl.libertyFile.empty()) {
-    eda::tool::fillingTechLib(options.rtl.libertyFile);
     nameFileLibrary = eda::tool::getName(options.rtl.libertyFile);
+
+    eda::gate::model::GateStore::Scope scope(libraryStore);
+    eda::tool::parseTechLib(options.rtl.libertyFile, libraryData);
   }
   for (auto file : options.rtl.files()) {
     RtlContext context(file);
+    // The library nets are built from the design's gate store.
+    eda::gate::model::GateStore::Scope scope(context.store);
     if (!nameFileLibrary.empty()) {
+      eda::tool::fillingTechLib(options.rtl.libertyFile, libraryData);
       context.techLib = nameFileLibrary;
     }
     result |= eda::tool::rtlMain(context, options.rtl);
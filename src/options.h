@@ -23,6 +23,9 @@ NLOHMANN_JSON_SERIALIZE_ENUM( eda::gate::debugger::options::LecType, {
   {eda::gate::debugger::options::RND, "rnd"},
   {eda::gate::debugger::options::DEFAULT, "default"},
   {eda::gate::debugger::options::BDD, "bdd"},
+  {eda::gate::debugger::options::BMC, "bmc"},
+  {eda::gate::debugger::options::FRAIG, "fraig"},
+  {eda::gate::debugger::options::PARALLEL, "parallel"},
 })
 
 NLOHMANN_JSON_SERIALIZE_ENUM( eda::gate::premapper::PreBasis, {
@@ -148,6 +151,9 @@ struct RtlOptions final : public AppOptions {
     {"rnd", LecType::RND},
     {"default", LecType::DEFAULT},
     {"bdd", LecType::BDD},
+    {"bmc", LecType::BMC},
+    {"fraig", LecType::FRAIG},
+    {"parallel", LecType::PARALLEL},
   };
   using PreBasis = eda::gate::premapper::PreBasis;
 
@@ -253,10 +259,41 @@ struct HlsOptions final : public AppOptions {
   std::string outTest;
 };
 
+struct RwdbOptions final : public AppOptions {
+  static constexpr const char *ID = "rwdb";
+
+  static constexpr const char *INPUT_SQLITE = "input-sqlite";
+  static constexpr const char *OUTPUT_BIN   = "output-bin";
+  static constexpr const char *INPUT_BIN    = "input-bin";
+
+  RwdbOptions(AppOptions &parent):
+      AppOptions(parent, ID, "Rewriting database") {
+
+    // Named options.
+    options->add_option(cli(INPUT_SQLITE), inSqlite, "Input SQLite database")
+           ->expected(1);
+    options->add_option(cli(OUTPUT_BIN),   outBin,   "Output binary database")
+           ->expected(1);
+    options->add_option(cli(INPUT_BIN),    inBin,
+                        "Input binary database (replaces the built-in one)")
+           ->expected(1);
+  }
+
+  void fromJson(Json json) override {
+    get(json, INPUT_SQLITE, inSqlite);
+    get(json, OUTPUT_BIN,   outBin);
+    get(json, INPUT_BIN,    inBin);
+  }
+
+  std::string inSqlite;
+  std::string outBin;
+  std::string inBin;
+};
+
 struct Options final : public AppOptions {
   Options(const std::string &title,
           const std::string &version):
-      AppOptions(title, version), rtl(*this), hls(*this) {
+      AppOptions(title, version), rtl(*this), hls(*this), rwdb(*this) {
 
     // Top-level options.
     options->set_help_all_flag("-H,--help-all", "Print the extended help message and exit");
@@ -277,8 +314,10 @@ struct Options final : public AppOptions {
   void fromJson(Json json) override {
     rtl.fromJson(json[RtlOptions::ID]);
     hls.fromJson(json[HlsOptions::ID]);
+    rwdb.fromJson(json[RwdbOptions::ID]);
   }
 
   RtlOptions rtl;
   HlsOptions hls;
+  RwdbOptions rwdb;
 };
@@ -143,16 +143,27 @@ std::string getName(std::string &path) {
   return std::filesystem::path(path).filename();
 }
 
-void fillingTechLib(std::string path) {
-  std::string namefile = getName(path);
-  auto db = RewriteManager::get().createDatabase(namefile);
-  NetData data;
+void parseTechLib(const std::string &path, NetData &data) {
   translateLibertyToDesign(path, data);
+  data.buildCells();
+}
+
+void fillingTechLib(const std::string &path, NetData &data) {
+  std::string namefile = std::filesystem::path(path).filename();
+  auto db = RewriteManager::get().createDatabase(namefile);
   data.fillDatabase(*db);
 }
 
+void fillingTechLib(std::string path) {
+  NetData data;
+  parseTechLib(path, data);
+  fillingTechLib(path, data);
+}
+
 int rtlMain(
     RtlContext &context, PreBasis basis, LecType type, std::string file) {
+  eda::gate::model::GateStore::Scope scope(context.store);
+
   ParseResult rc = parse(context);
   if (rc == PARSE_INVALID) {
     return -1;
@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 #include "gate/debugger/base_checker.h"
 #include "gate/debugger/checker.h"
+#include "gate/library/liberty/net_data.h"
 #include "gate/model/gnet.h"
 #include "gate/optimizer/optimizer.h"
 #include "gate/optimizer/strategy/exhaustive_search_optimizer.h"
@@ -51,6 +52,9 @@ struct RtlContext {
   RtlContext(const std::string &file):
     file(file) {}
 
+  /// Gates of the design (declared first to be destroyed last).
+  eda::gate::model::GateStore store;
+
   const std::string file;
 
   std::shared_ptr<VNet> vnet;
@@ -87,6 +91,14 @@ bool techMap(RtlContext &context);
 
 std::string getName(std::string &path);
 
+/// Parses the Liberty file: the cells are built in the current gate store.
+void parseTechLib(const std::string &path, NetData &data);
+
+/// Fills the database of the library w/ the parsed cells (the database
+/// nets are built in the current gate store).
+void fillingTechLib(const std::string &path, NetData &data);
+
+/// Parses the Liberty file and fills the database of the library.
 void fillingTechLib(std::string path);
 
 int rtlMain(RtlContext &context, PreBasis basis, LecType type, 
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace eda::utils {
+
+/**
+ * \brief Implements the xoshiro256** pseudo-random generator.
+ *
+ * The generator produces 64 random bits per call and satisfies the
+ * UniformRandomBitGenerator requirements. The state is seeded w/ the
+ * splitmix64 sequence (as recommended by the algorithm's authors).
+ */
+class Xoshiro256 final {
+public:
+  using result_type = uint64_t;
+
+  static constexpr result_type min() {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  explicit Xoshiro256(uint64_t seed = 0) {
+    this->seed(seed);
+  }
+
+  /// Resets the generator state.
+  void seed(uint64_t seed) {
+    for (auto &word : state) {
+      // Splitmix64.
+      uint64_t z = (seed += 0x9e3779b97f4a7c15ull);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+      word = z ^ (z >> 31);
+    }
+  }
+
+  /// Returns the next 64 random bits.
+  result_type operator()() {
+    const uint64_t result = rotl(state[1] * 5, 7) * 9;
+    const uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+
+    return result;
+  }
+
+private:
+  static uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  uint64_t state[4];
+};
+
+} // namespace eda::utils
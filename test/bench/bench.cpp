@@ -0,0 +1,180 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "bench/bench.h"
+
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <regex>
+#include <sys/resource.h>
+
+namespace eda::bench {
+
+bool State::keepRunning() {
+  if (!started) {
+    started = true;
+    start = Clock::now();
+    return true;
+  }
+
+  iterations++;
+
+  const auto finish = Clock::now();
+  if (!paused) {
+    seconds += std::chrono::duration<double>(finish - start).count();
+  }
+  start = finish;
+  paused = false;
+
+  return error.empty() && seconds < minTime && iterations < maxIterations;
+}
+
+void State::pause() {
+  if (!paused) {
+    seconds += std::chrono::duration<double>(Clock::now() - start).count();
+    paused = true;
+  }
+}
+
+void State::resume() {
+  if (paused) {
+    start = Clock::now();
+    paused = false;
+  }
+}
+
+std::vector<std::string> Registry::list(const std::string &filter) const {
+  const std::regex pattern(filter);
+
+  std::vector<std::string> names;
+  for (const auto &benchmark : benchmarks) {
+    if (std::regex_search(benchmark.name, pattern)) {
+      names.push_back(benchmark.name);
+    }
+  }
+  return names;
+}
+
+nlohmann::json Registry::run(const std::string &filter,
+                             double minTime,
+                             std::size_t maxIterations,
+                             bool verbose) const {
+  const std::regex pattern(filter);
+
+  nlohmann::json results = nlohmann::json::array();
+  for (const auto &benchmark : benchmarks) {
+    if (!std::regex_search(benchmark.name, pattern)) {
+      continue;
+    }
+
+    // The peak is measured per benchmark if the kernel allows resetting it.
+    const bool isPeakReset = resetPeakRss();
+    const auto rss = getRss();
+
+    State state(minTime, maxIterations);
+    try {
+      benchmark.function(state);
+    } catch (const std::exception &e) {
+      state.setError(e.what());
+    } catch (const char *msg) {
+      state.setError(msg);
+    }
+
+    const auto iterations = state.getIterations();
+    const auto seconds = state.getSeconds();
+
+    nlohmann::json result;
+    result["name"] = benchmark.name;
+    result["iterations"] = iterations;
+    result["gates"] = state.getGates();
+    result["time_s"] = seconds;
+    result["time_per_iteration_s"] = iterations ? seconds / iterations : 0.;
+    result["gates_per_s"] =
+        seconds > 0 ? (state.getGates() * iterations) / seconds : 0.;
+    result[isPeakReset ? "peak_rss_kb" : "process_peak_rss_kb"] = getPeakRss();
+    result["rss_delta_kb"] = getRss() - rss;
+    if (!state.getError().empty()) {
+      result["error"] = state.getError();
+    }
+
+    if (verbose) {
+      std::cerr << benchmark.name << ": "
+                << result["time_per_iteration_s"] << " s/iteration, "
+                << result["gates_per_s"] << " gates/s" << std::endl;
+    }
+
+    results.push_back(result);
+  }
+
+  return results;
+}
+
+void compare(nlohmann::json &results, const nlohmann::json &baseline) {
+  std::map<std::string, double> times;
+  for (const auto &result : baseline) {
+    times[result["name"]] = result["time_per_iteration_s"];
+  }
+
+  for (auto &result : results) {
+    const auto i = times.find(result["name"]);
+    if (i == times.end()) {
+      continue;
+    }
+
+    const double time = result["time_per_iteration_s"];
+    result["baseline_time_per_iteration_s"] = i->second;
+    result["speedup"] = time > 0 ? i->second / time : 0.;
+  }
+}
+
+/// Returns the value of the field of /proc/self/status (in KB) or -1.
+static long getStatus(const std::string &field) {
+  std::ifstream status("/proc/self/status");
+  std::string name;
+  long value;
+  while (status >> name >> value) {
+    if (name == field + ":") {
+      return value;
+    }
+    status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  }
+  return -1;
+}
+
+bool resetPeakRss() {
+  std::ofstream clearRefs("/proc/self/clear_refs");
+  return static_cast<bool>(clearRefs << "5" << std::flush);
+}
+
+long getPeakRss() {
+  const auto peak = getStatus("VmHWM");
+  if (peak >= 0) {
+    return peak;
+  }
+
+  struct rusage usage;
+  return getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : 0;
+}
+
+long getRss() {
+  const auto rss = getStatus("VmRSS");
+  return rss >= 0 ? rss : 0;
+}
+
+std::string getDataPath(const std::string &path) {
+  const char *home = std::getenv("UTOPIA_HOME");
+  const std::filesystem::path homePath = home ? home : ".";
+  return homePath / "test/data" / path;
+}
+
+} // namespace eda::bench
@@ -0,0 +1,126 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "nlohmann/json.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace eda::bench {
+
+/**
+ * \brief State of a running benchmark (as in Google Benchmark).
+ *
+ * The measured code is executed in the while (state.keepRunning()) loop;
+ * the iterations are repeated until the time budget is exhausted.
+ */
+class State final {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  State(double minTime, std::size_t maxIterations):
+      minTime(minTime), maxIterations(maxIterations) {}
+
+  /// Checks whether one more iteration should be executed.
+  bool keepRunning();
+
+  /// Excludes the code from the measurement (e.g., per-iteration setup).
+  void pause();
+  /// Resumes the measurement.
+  void resume();
+
+  /// Sets the number of gates processed per iteration.
+  void setGates(std::size_t nGates) { this->nGates = nGates; }
+
+  /// Sets the error message (the benchmark is reported as failed).
+  void setError(const std::string &error) { this->error = error; }
+
+  std::size_t getIterations() const { return iterations; }
+  std::size_t getGates() const { return nGates; }
+  double getSeconds() const { return seconds; }
+  const std::string &getError() const { return error; }
+
+private:
+  const double minTime;
+  const std::size_t maxIterations;
+
+  bool started = false;
+  bool paused = false;
+  std::size_t iterations = 0;
+  std::size_t nGates = 0;
+  double seconds = 0;
+  Clock::time_point start;
+  std::string error;
+};
+
+/**
+ * \brief Registry of the benchmarks.
+ */
+class Registry final {
+public:
+  using Function = std::function<void(State &)>;
+
+  static Registry &get() {
+    static Registry registry;
+    return registry;
+  }
+
+  /// Registers the benchmark.
+  void add(const std::string &name, Function function) {
+    benchmarks.push_back({name, function});
+  }
+
+  /// Returns the names of the benchmarks that match the filter.
+  std::vector<std::string> list(const std::string &filter) const;
+
+  /// Runs the benchmarks whose names match the filter (regular expression)
+  /// and returns the results in JSON.
+  nlohmann::json run(const std::string &filter,
+                     double minTime,
+                     std::size_t maxIterations,
+                     bool verbose) const;
+
+private:
+  struct Benchmark {
+    std::string name;
+    Function function;
+  };
+
+  Registry() = default;
+
+  std::vector<Benchmark> benchmarks;
+};
+
+/// Compares the results w/ the baseline ones (produced by an earlier run):
+/// the results of the benchmarks found in the baseline are extended w/
+/// the baseline time per iteration and the speedup.
+void compare(nlohmann::json &results, const nlohmann::json &baseline);
+
+/// Resets the peak resident set size of the process (Linux only);
+/// returns false if it is not supported.
+bool resetPeakRss();
+
+/// Returns the peak resident set size of the process since the start or
+/// the last reset (in KB).
+long getPeakRss();
+
+/// Returns the current resident set size of the process (in KB).
+long getRss();
+
+/// Returns the path to the test data (UTOPIA_HOME/test/data/<path>).
+std::string getDataPath(const std::string &path);
+
+/// Registers the benchmarks of the gate-level subsystems.
+void registerGateBenchmarks(Registry &registry, unsigned scale);
+
+} // namespace eda::bench
@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "bench/bench.h"
+
+#include "CLI/CLI.hpp"
+#include "easylogging++.h"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+INITIALIZE_EASYLOGGINGPP
+
+int main(int argc, char **argv) {
+  START_EASYLOGGINGPP(argc, argv);
+
+  std::string filter = ".*";
+  std::string output;
+  std::string baseline;
+  double minTime = 0.5;
+  std::size_t maxIterations = 1000000;
+  unsigned scale = 1;
+  bool list = false;
+  bool verbose = false;
+
+  CLI::App app("Utopia EDA benchmarks");
+  app.add_option("--filter", filter, "Benchmark name filter (regex)");
+  app.add_option("--output", output, "Output JSON file (stdout by default)");
+  app.add_option("--baseline", baseline,
+                 "Baseline JSON file (to compare the results with)");
+  app.add_option("--min-time", minTime, "Minimal time per benchmark (s)");
+  app.add_option("--max-iterations", maxIterations,
+                 "Maximal number of iterations per benchmark");
+  app.add_option("--scale", scale, "Scale of the synthetic nets");
+  app.add_flag("--list", list, "List the benchmarks and exit");
+  app.add_flag("--verbose", verbose, "Print the results to stderr");
+
+  try {
+    app.parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app.exit(e);
+  }
+
+  auto &registry = eda::bench::Registry::get();
+  eda::bench::registerGateBenchmarks(registry, scale);
+
+  if (list) {
+    for (const auto &name : registry.list(filter)) {
+      std::cout << name << std::endl;
+    }
+    return 0;
+  }
+
+  nlohmann::json json;
+  json["context"]["scale"] = scale;
+  json["context"]["min_time_s"] = minTime;
+  json["benchmarks"] = registry.run(filter, minTime, maxIterations, verbose);
+
+  if (!baseline.empty()) {
+    std::ifstream in(baseline);
+    if (!in) {
+      std::cerr << "Can't open the baseline file: " << baseline << std::endl;
+      return 1;
+    }
+    const auto previous = nlohmann::json::parse(in);
+    eda::bench::compare(json["benchmarks"], previous["benchmarks"]);
+  }
+
+  if (output.empty()) {
+    std::cout << json.dump(2) << std::endl;
+  } else {
+    std::ofstream out(output);
+    out << json.dump(2) << std::endl;
+  }
+
+  return 0;
+}
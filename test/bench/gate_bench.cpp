@@ -0,0 +1,333 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "bench/bench.h"
+#include "gate/debugger/base_checker.h"
+#include "gate/optimizer/cuts_finder.h"
+#include "gate/optimizer/optimizer.h"
+#include "gate/optimizer/parallel_eval_rewriter.h"
+#include "gate/optimizer/rwmanager.h"
+#include "gate/optimizer/strategy/apply_search_optimizer.h"
+#include "gate/optimizer/tech_map/strategy/replacement_cut.h"
+#include "gate/optimizer/tech_map/strategy/simple_techmapper.h"
+#include "gate/optimizer/tech_map/tech_mapper.h"
+#include "gate/parser/bench/parser.h"
+#include "gate/parser/glverilog/parser.h"
+#include "gate/premapper/premapper.h"
+#include "gate/simulator/simulator.h"
+#include "tool/rtl_context.h"
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace eda::bench {
+
+using Gate = gate::model::Gate;
+using GateIdMap = std::unordered_map<Gate::Id, Gate::Id>;
+using GateSymbol = gate::model::GateSymbol;
+using GNet = gate::model::GNet;
+using LecType = gate::debugger::options::LecType;
+using PreBasis = gate::premapper::PreBasis;
+
+/// ISCAS netlists used in the benchmarks.
+static const std::vector<std::string> ISCAS = {
+  "c432", "c499", "c6288", "s5378", "s38584"
+};
+
+/// Small ISCAS netlists (for the expensive benchmarks).
+static const std::vector<std::string> ISCAS_SMALL = {
+  "c17", "c432", "c499"
+};
+
+/// Sizes of the synthetic nets (multiplied by the scale).
+static const std::vector<std::size_t> SYNTHETIC = {10000, 100000};
+
+static const std::map<std::string, PreBasis> BASES = {
+  {"aig", PreBasis::AIG},
+  {"mig", PreBasis::MIG},
+  {"xag", PreBasis::XAG},
+  {"xmg", PreBasis::XMG}
+};
+
+static const std::map<std::string, LecType> CHECKERS = {
+  {"sat", LecType::DEFAULT},
+  {"bdd", LecType::BDD},
+  {"bmc", LecType::BMC},
+  {"fraig", LecType::FRAIG},
+  {"parallel", LecType::PARALLEL},
+  {"rnd", LecType::RND}
+};
+
+static std::shared_ptr<GNet> parseIscas(const std::string &name) {
+  std::vector<std::unique_ptr<GNet>> nets;
+  if (!parseGateLevelVerilog(getDataPath("glverilog/ISCAS/" + name + ".v"),
+                             nets) || nets.empty()) {
+    throw "Can't parse the ISCAS net.";
+  }
+
+  std::shared_ptr<GNet> net(std::move(nets.front()));
+  net->sortTopologically();
+  return net;
+}
+
+/// Random DAG of AND/OR/XOR/NOT gates (the last gates are the outputs).
+static std::shared_ptr<GNet> makeSynthetic(std::size_t nGates) {
+  auto net = std::make_shared<GNet>();
+
+  const std::size_t nIn = std::max<std::size_t>(nGates / 100, 8);
+  const std::size_t nOut = nIn;
+
+  std::vector<Gate::Id> nodes;
+  nodes.reserve(nIn + nGates);
+  for (std::size_t i = 0; i < nIn; i++) {
+    nodes.push_back(net->addIn());
+  }
+
+  const GateSymbol funcs[] = {GateSymbol::AND, GateSymbol::OR,
+                              GateSymbol::XOR, GateSymbol::AND};
+
+  std::mt19937_64 gen(nGates);
+  for (std::size_t i = 0; i < nGates; i++) {
+    // Locality: the fanins are mostly chosen among the recent nodes.
+    const auto window = std::min<std::size_t>(nodes.size(), 1024);
+    const auto x = nodes[nodes.size() - 1 - gen() % window];
+    const auto y = nodes[nodes.size() - 1 - gen() % window];
+
+    nodes.push_back(x == y ? net->addNot(x)
+                           : net->addGate(funcs[gen() % 4],
+                                          {Gate::Signal::always(x),
+                                           Gate::Signal::always(y)}));
+  }
+
+  for (std::size_t i = nodes.size() - nOut; i < nodes.size(); i++) {
+    net->addOut(nodes[i]);
+  }
+
+  net->sortTopologically();
+  return net;
+}
+
+/// Returns the named net (parsed or generated once).
+static std::shared_ptr<GNet> getNet(const std::string &name) {
+  static std::map<std::string, std::shared_ptr<GNet>> nets;
+
+  auto i = nets.find(name);
+  if (i == nets.end()) {
+    auto net = name.rfind("synthetic", 0) == 0
+        ? makeSynthetic(std::stoull(name.substr(name.find('_') + 1)))
+        : parseIscas(name);
+    i = nets.emplace(name, net).first;
+  }
+  return i->second;
+}
+
+/// Returns the net premapped to the given basis.
+static std::shared_ptr<GNet> getPremapped(const std::string &name,
+                                          PreBasis basis,
+                                          GateIdMap &gmap) {
+  auto net = gate::premapper::getPreMapper(basis).map(*getNet(name), gmap);
+  net->sortTopologically();
+  return net;
+}
+
+static void registerParserBenchmarks(Registry &registry) {
+  for (const auto &name : ISCAS) {
+    registry.add("parser/glverilog/" + name, [name](State &state) {
+      const auto path = getDataPath("glverilog/ISCAS/" + name + ".v");
+      while (state.keepRunning()) {
+        std::vector<std::unique_ptr<GNet>> nets;
+        parseGateLevelVerilog(path, nets);
+        state.setGates(nets.empty() ? 0 : nets.front()->nGates());
+      }
+    });
+  }
+
+  for (const std::string name : {"s27", "s298"}) {
+    registry.add("parser/bench/" + name, [name](State &state) {
+      const auto path = getDataPath("bench/" + name + ".bench");
+      while (state.keepRunning()) {
+        auto net = parseBenchFile(path);
+        state.setGates(net ? net->nGates() : 0);
+      }
+    });
+  }
+}
+
+static void registerPremapperBenchmarks(Registry &registry,
+                                        const std::vector<std::string> &nets) {
+  for (const auto &[basisName, basis] : BASES) {
+    for (const auto &name : nets) {
+      registry.add("premapper/" + basisName + "/" + name,
+                   [name, basis = basis](State &state) {
+        const auto net = getNet(name);
+        state.setGates(net->nGates());
+        while (state.keepRunning()) {
+          gate::premapper::getPreMapper(basis).map(*net);
+        }
+      });
+    }
+  }
+}
+
+static void registerCutsBenchmarks(Registry &registry,
+                                   const std::vector<std::string> &nets) {
+  for (const int k : {4, 6}) {
+    for (const auto &name : nets) {
+      registry.add("cuts/k" + std::to_string(k) + "/" + name,
+                   [name, k](State &state) {
+        GateIdMap gmap;
+        const auto net = getPremapped(name, PreBasis::AIG, gmap);
+        state.setGates(net->nGates());
+        while (state.keepRunning()) {
+          gate::optimizer::CutStorage storage;
+          gate::optimizer::CutsFinder(k).find(*net, storage);
+        }
+      });
+    }
+  }
+}
+
+static void registerRewriteBenchmarks(Registry &registry,
+                                      const std::vector<std::string> &nets) {
+  for (const auto &name : nets) {
+    registry.add("rewrite/" + name, [name](State &state) {
+      gate::optimizer::RewriteManager::get().initialize();
+
+      GateIdMap gmap;
+      const auto net = getPremapped(name, PreBasis::AIG, gmap);
+      state.setGates(net->nGates());
+      while (state.keepRunning()) {
+        state.pause();
+        std::unique_ptr<GNet> copy(net->clone());
+        state.resume();
+
+        gate::optimizer::optimize(copy.get(), 4,
+                                  gate::optimizer::ApplySearchOptimizer());
+      }
+    });
+
+    registry.add("rewrite-parallel-eval/" + name, [name](State &state) {
+      gate::optimizer::ParallelEvalRewriter rewriter("abc", 4);
+
+      GateIdMap gmap;
+      const auto net = getPremapped(name, PreBasis::AIG, gmap);
+      state.setGates(net->nGates());
+      while (state.keepRunning()) {
+        state.pause();
+        std::unique_ptr<GNet> copy(net->clone());
+        state.resume();
+
+        rewriter.rewrite(*copy);
+      }
+    });
+  }
+}
+
+static void registerTechMapBenchmarks(Registry &registry,
+                                      const std::vector<std::string> &nets) {
+  for (const auto &name : nets) {
+    registry.add("techmap/" + name, [name](State &state) {
+      // The library database is filled once.
+      static std::string library = getDataPath("gate/liberty/normal1.lib");
+      static const auto libraryName = tool::getName(library);
+      static bool loaded = false;
+      if (!loaded) {
+        tool::fillingTechLib(library);
+        loaded = true;
+      }
+
+      GateIdMap gmap;
+      const auto net = getPremapped(name, PreBasis::AIG, gmap);
+      state.setGates(net->nGates());
+      while (state.keepRunning()) {
+        state.pause();
+        std::unique_ptr<GNet> copy(net->clone());
+        state.resume();
+
+        gate::optimizer::techMap(
+            copy.get(), 4,
+            gate::optimizer::SimpleTechMapper(libraryName.c_str()),
+            gate::optimizer::ReplacementVisitor());
+      }
+    });
+  }
+}
+
+static void registerSimulatorBenchmarks(Registry &registry,
+                                        const std::vector<std::string> &nets) {
+  using Compiled = gate::simulator::Simulator::Compiled;
+
+  for (const auto &name : nets) {
+    registry.add("simulator/" + name, [name](State &state) {
+      const auto net = getNet(name);
+
+      GNet::LinkList in(net->sourceLinks().begin(), net->sourceLinks().end());
+      GNet::LinkList out(net->targetLinks().begin(), net->targetLinks().end());
+
+      gate::simulator::Simulator simulator;
+      auto compiled = simulator.compile(*net, in, out);
+
+      Compiled::WV i(in.size()), o(out.size());
+      std::mt19937_64 gen(0);
+
+      // Each iteration evaluates WIDTH patterns.
+      state.setGates(net->nGates() * Compiled::WIDTH);
+      while (state.keepRunning()) {
+        for (auto &word : i) {
+          word = gen();
+        }
+        compiled.simulate(o, i);
+      }
+    });
+  }
+}
+
+static void registerCheckerBenchmarks(Registry &registry,
+                                      const std::vector<std::string> &nets) {
+  for (const auto &[checkerName, type] : CHECKERS) {
+    for (const auto &name : nets) {
+      registry.add("lec/" + checkerName + "/" + name,
+                   [name, type = type](State &state) {
+        GateIdMap gmap;
+        const auto net = getNet(name);
+        const auto premapped = getPremapped(name, PreBasis::AIG, gmap);
+
+        auto &checker = gate::debugger::getChecker(type);
+        state.setGates(net->nGates() + premapped->nGates());
+        while (state.keepRunning()) {
+          if (!checker.areEqual(*net, *premapped, gmap)) {
+            state.setError("The nets are not equivalent");
+          }
+        }
+      });
+    }
+  }
+}
+
+void registerGateBenchmarks(Registry &registry, unsigned scale) {
+  std::vector<std::string> nets = ISCAS;
+  for (const auto size : SYNTHETIC) {
+    nets.push_back("synthetic_" + std::to_string(size * scale));
+  }
+
+  std::vector<std::string> smallNets = ISCAS_SMALL;
+  smallNets.push_back("synthetic_" + std::to_string(1000 * scale));
+
+  registerParserBenchmarks(registry);
+  registerPremapperBenchmarks(registry, nets);
+  registerCutsBenchmarks(registry, nets);
+  registerRewriteBenchmarks(registry, smallNets);
+  registerTechMapBenchmarks(registry, smallNets);
+  registerSimulatorBenchmarks(registry, nets);
+  registerCheckerBenchmarks(registry, smallNets);
+}
+
+} // namespace eda::bench
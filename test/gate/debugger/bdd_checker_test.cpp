@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/bdd_checker.h"
+#include "gate/model/gnet_test.h"
+#include "gate/premapper/mapper/mapper_test.h"
+
+#include "gtest/gtest.h"
+
+using namespace eda::gate::debugger;
+using namespace eda::gate::model;
+
+static bool checkAdders(unsigned N, bool faulty, std::size_t nodeLimit) {
+  Gate::SignalList lhsInputs, lhsOutputs;
+  auto lhs = makeAdder(N, lhsInputs, lhsOutputs);
+
+  Gate::SignalList rhsInputs, rhsOutputs;
+  auto rhs = makeAdder(N, rhsInputs, rhsOutputs, faulty);
+
+  GateIdMap premapMap;
+  auto premapped = premap(rhs, premapMap, PreBasis::AIG);
+
+  GateIdMap gmap;
+  for (std::size_t i = 0; i < lhsInputs.size(); i++) {
+    gmap[lhsInputs[i].node()] = premapMap[rhsInputs[i].node()];
+  }
+  for (std::size_t i = 0; i < lhsOutputs.size(); i++) {
+    gmap[lhsOutputs[i].node()] = premapMap[rhsOutputs[i].node()];
+  }
+
+  auto &checker = BddChecker::get();
+  checker.setNodeLimit(nodeLimit);
+
+  return checker.areEqual(*lhs, *premapped, gmap);
+}
+
+TEST(BddCheckerTest, AdderTest) {
+  EXPECT_TRUE(checkAdders(32, false, BddChecker::DEFAULT_NODE_LIMIT));
+
+  const auto &stats = BddChecker::get().getStats();
+  EXPECT_EQ(0u, stats.nSat);
+  EXPECT_LT(0u, stats.nBdd);
+}
+
+TEST(BddCheckerTest, FaultyAdderTest) {
+  EXPECT_FALSE(checkAdders(32, true, BddChecker::DEFAULT_NODE_LIMIT));
+}
+
+TEST(BddCheckerTest, SatFallbackTest) {
+  EXPECT_TRUE(checkAdders(32, false, 8));
+  EXPECT_LT(0u, BddChecker::get().getStats().nSat);
+
+  EXPECT_FALSE(checkAdders(32, true, 8));
+  BddChecker::get().setNodeLimit(BddChecker::DEFAULT_NODE_LIMIT);
+}
+
+TEST(BddCheckerTest, PremappedNetsTest) {
+  for (auto func : {GateSymbol::AND, GateSymbol::OR, GateSymbol::XOR,
+                    GateSymbol::NAND, GateSymbol::NOR, GateSymbol::XNOR}) {
+    auto net = makeSingleGateNet(func, 7);
+    GateIdMap gmap;
+    auto premapped = premap(net, gmap, PreBasis::AIG);
+    EXPECT_TRUE(BddChecker::get().areEqual(*net, *premapped, gmap));
+  }
+}
+
+static bool checkExternalInputs(bool faulty) {
+  // The inputs do not belong to the nets (and are shared by them).
+  GNet inputs;
+  const auto x = inputs.newGate();
+  const auto y = inputs.newGate();
+
+  GNet lhs;
+  const auto lhsAnd = lhs.addGate(GateSymbol::AND, {Gate::Signal::always(x),
+                                                   Gate::Signal::always(y)});
+  const auto lhsOut = lhs.addGate(GateSymbol::OUT,
+                                  {Gate::Signal::always(lhsAnd)});
+
+  // x & y = ~(~x | ~y).
+  GNet rhs;
+  const auto nx = rhs.addGate(GateSymbol::NOT, {Gate::Signal::always(x)});
+  const auto ny = rhs.addGate(GateSymbol::NOT, {Gate::Signal::always(y)});
+  const auto rhsNor = rhs.addGate(faulty ? GateSymbol::OR : GateSymbol::NOR,
+                                  {Gate::Signal::always(nx),
+                                   Gate::Signal::always(ny)});
+  const auto rhsOut = rhs.addGate(GateSymbol::OUT,
+                                  {Gate::Signal::always(rhsNor)});
+
+  GateIdMap gmap{{lhsOut, rhsOut}};
+  return BddChecker::get().areEqual(lhs, rhs, gmap);
+}
+
+TEST(BddCheckerTest, ExternalInputsTest) {
+  EXPECT_TRUE(checkExternalInputs(false));
+  EXPECT_FALSE(checkExternalInputs(true));
+}
@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/bmc_checker.h"
+#include "gate/debugger/checker.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+using namespace eda::gate::debugger;
+using namespace eda::gate::model;
+
+using GateIdMap = BmcChecker::GateIdMap;
+
+/// Sequential net w/ the inputs (x, y, clk) and a single output.
+struct SeqNet final {
+  SeqNet(): net(std::make_shared<GNet>()) {
+    x = net->addIn();
+    y = net->addIn();
+    clk = net->addIn();
+  }
+
+  void setOutput(Gate::Id gateId) {
+    out = net->addOut(gateId);
+    net->sortTopologically();
+  }
+
+  std::shared_ptr<GNet> net;
+  Gate::Id x, y, clk, out;
+};
+
+static GateIdMap bindPorts(const SeqNet &lhs, const SeqNet &rhs) {
+  return GateIdMap{{lhs.x, rhs.x},
+                   {lhs.y, rhs.y},
+                   {lhs.clk, rhs.clk},
+                   {lhs.out, rhs.out}};
+}
+
+// out = DFF(x & y).
+static SeqNet makeAndDff() {
+  SeqNet seq;
+  auto &net = *seq.net;
+  seq.setOutput(net.addDff(net.addAnd(seq.x, seq.y), seq.clk));
+  return seq;
+}
+
+// out = DFF(x) & DFF(y) (the trigger is moved over the AND gate).
+static SeqNet makeRetimedAndDff() {
+  SeqNet seq;
+  auto &net = *seq.net;
+  seq.setOutput(net.addAnd(net.addDff(seq.x, seq.clk),
+                           net.addDff(seq.y, seq.clk)));
+  return seq;
+}
+
+// out = DFF(DFF(x & y)).
+static SeqNet makeAndDff2() {
+  SeqNet seq;
+  auto &net = *seq.net;
+  seq.setOutput(net.addDff(net.addDff(net.addAnd(seq.x, seq.y), seq.clk),
+                           seq.clk));
+  return seq;
+}
+
+TEST(BmcCheckerTest, RetimedTest) {
+  auto lhs = makeAndDff();
+  auto rhs = makeRetimedAndDff();
+  auto gmap = bindPorts(lhs, rhs);
+
+  auto &checker = BmcChecker::get();
+
+  EXPECT_TRUE(checker.areEqual(*lhs.net, *rhs.net, gmap));
+  EXPECT_EQ(BmcChecker::NO_DIVERGENCE,
+            checker.findDivergence(*lhs.net, *rhs.net, gmap, 8));
+}
+
+TEST(BmcCheckerTest, DivergingCycleTest) {
+  auto lhs = makeAndDff();
+  auto rhs = makeAndDff2();
+  auto gmap = bindPorts(lhs, rhs);
+
+  auto &checker = BmcChecker::get();
+
+  // Both outputs are zero at cycle 0.
+  EXPECT_FALSE(checker.areEqual(*lhs.net, *rhs.net, gmap));
+  EXPECT_EQ(1u, checker.findDivergence(*lhs.net, *rhs.net, gmap, 8));
+
+  // The difference is not reachable in one cycle.
+  EXPECT_EQ(BmcChecker::NO_DIVERGENCE,
+            checker.findDivergence(*lhs.net, *rhs.net, gmap, 1));
+}
+
+TEST(BmcCheckerTest, UnknownTriggerBindingTest) {
+  auto lhs = makeAndDff();
+  auto rhs = makeRetimedAndDff();
+  auto gmap = bindPorts(lhs, rhs);
+
+  // The triggers are not bound: the default checker falls back to BMC.
+  EXPECT_TRUE(Checker::get().areEqual(*lhs.net, *rhs.net, gmap));
+}
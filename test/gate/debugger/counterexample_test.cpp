@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/checker.h"
+#include "gate/debugger/counterexample.h"
+#include "gate/model/gnet_test.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+using namespace eda::gate::debugger;
+using namespace eda::gate::model;
+
+using GateBinding = Checker::GateBinding;
+
+// Checks (x1 & ... & xN) vs. (x1 | ... | xN) and replays the counterexample.
+static void checkAndOr(unsigned N, std::size_t nExpectedInputs) {
+  Gate::SignalList lhsInputs;
+  Gate::Id lhsOutputId;
+  auto lhs = makeAnd(N, lhsInputs, lhsOutputId);
+
+  Gate::SignalList rhsInputs;
+  Gate::Id rhsOutputId;
+  auto rhs = makeOr(N, rhsInputs, rhsOutputId);
+
+  GateBinding ibind, obind;
+  for (unsigned i = 0; i < N; i++) {
+    ibind.insert({Gate::Link(lhsInputs[i].node()),
+                  Gate::Link(rhsInputs[i].node())});
+  }
+  obind.insert({Gate::Link(lhsOutputId), Gate::Link(rhsOutputId)});
+
+  Checker::Hints hints;
+  hints.sourceBinding = std::make_shared<GateBinding>(ibind);
+  hints.targetBinding = std::make_shared<GateBinding>(obind);
+
+  Checker checker;
+  Counterexample cex;
+  EXPECT_FALSE(checker.areEqual(*lhs, *rhs, hints, &cex));
+
+  EXPECT_EQ(N, cex.nInputs);
+  EXPECT_EQ(nExpectedInputs, cex.inputs.size());
+
+  std::stringstream out;
+  EXPECT_TRUE(replayCounterexample(*lhs, *rhs, ibind, obind, cex, out));
+  EXPECT_NE(std::string::npos, out.str().find("Outputs diverge"));
+}
+
+TEST(CounterexampleTest, SimulationTest) {
+  // The counterexample found by simulation is not minimized.
+  checkAndOr(8, 8);
+}
+
+TEST(CounterexampleTest, MinimizationTest) {
+  // A zero and a one suffice to distinguish AND from OR.
+  checkAndOr(32, 2);
+}
+
+TEST(CounterexampleTest, NoDivergenceTest) {
+  const unsigned N = 4;
+
+  Gate::SignalList lhsInputs;
+  Gate::Id lhsOutputId;
+  auto lhs = makeNor(N, lhsInputs, lhsOutputId);
+
+  Gate::SignalList rhsInputs;
+  Gate::Id rhsOutputId;
+  auto rhs = makeAndn(N, rhsInputs, rhsOutputId);
+
+  GateBinding ibind, obind;
+  for (unsigned i = 0; i < N; i++) {
+    ibind.insert({Gate::Link(lhsInputs[i].node()),
+                  Gate::Link(rhsInputs[i].node())});
+  }
+  obind.insert({Gate::Link(lhsOutputId), Gate::Link(rhsOutputId)});
+
+  Counterexample cex;
+  cex.nInputs = N;
+  cex.inputs.push_back({lhsInputs[0].node(), true});
+
+  std::stringstream out;
+  EXPECT_FALSE(replayCounterexample(*lhs, *rhs, ibind, obind, cex, out));
+}
@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/encoder.h"
+#include "gate/model/gnet_test.h"
+
+#include "gtest/gtest.h"
+
+using namespace eda::gate::debugger;
+using namespace eda::gate::model;
+
+TEST(EncoderTest, IncrementalQueriesTest) {
+  const unsigned N = 16;
+
+  // ~(x1 | ... | xN).
+  Gate::SignalList norInputs;
+  Gate::Id norOutputId;
+  auto norNet = makeNor(N, norInputs, norOutputId);
+
+  // (~x1 & ... & ~xN).
+  Gate::SignalList andnInputs;
+  Gate::Id andnOutputId;
+  auto andnNet = makeAndn(N, andnInputs, andnOutputId);
+
+  // (x1 & ... & xN).
+  Gate::SignalList andInputs;
+  Gate::Id andOutputId;
+  auto andNet = makeAnd(N, andInputs, andOutputId);
+
+  Encoder encoder;
+
+  // Equate the inputs.
+  for (unsigned i = 0; i < N; i++) {
+    const auto x = encoder.var(norInputs[i].node(), 0);
+    encoder.encodeBuf(encoder.var(andnInputs[i].node(), 0), x, true);
+    encoder.encodeBuf(encoder.var(andInputs[i].node(), 0), x, true);
+  }
+
+  const auto &norOutput = *Gate::get(norOutputId);
+  const auto &andnOutput = *Gate::get(andnOutputId);
+  const auto &andOutput = *Gate::get(andOutputId);
+
+  encoder.encodeCone(norOutput, 0);
+  encoder.encodeCone(andnOutput, 0);
+  EXPECT_TRUE(encoder.isEncoded(norOutputId, 0));
+  EXPECT_TRUE(encoder.isEncoded(norInputs[0].node(), 0));
+  EXPECT_FALSE(encoder.isEncoded(andOutputId, 0));
+
+  // The encoded cones are reused.
+  const auto nClauses = encoder.context().solver().nClauses();
+  encoder.encodeCone(norOutput, 0);
+  encoder.encode(*norNet, 0);
+  EXPECT_EQ(nClauses, encoder.context().solver().nClauses());
+
+  const auto norVar = encoder.var(norOutputId, 0);
+  const auto andnVar = encoder.var(andnOutputId, 0);
+
+  // NOR == ANDN.
+  Context::Clause assumptions;
+  assumptions.push(encoder.encodeDiff({{norVar, andnVar}}));
+  EXPECT_FALSE(encoder.solve(assumptions));
+  encoder.release(assumptions[0]);
+
+  // NOR != AND.
+  encoder.encodeCone(andOutput, 0);
+  const auto andVar = encoder.var(andOutputId, 0);
+
+  assumptions.clear();
+  assumptions.push(encoder.encodeDiff({{norVar, andVar}}));
+  EXPECT_TRUE(encoder.solve(assumptions));
+  encoder.release(assumptions[0]);
+
+  // The released query does not affect the subsequent ones.
+  assumptions.clear();
+  assumptions.push(encoder.encodeDiff({{andnVar, norVar}}));
+  EXPECT_FALSE(encoder.solve(assumptions));
+
+  // The formula itself is satisfiable.
+  EXPECT_TRUE(encoder.solve());
+}
+
+TEST(EncoderTest, DenseVariablesTest) {
+  Context context;
+
+  // Large identifiers and versions do not collide.
+  const auto x = context.var(1u << 30, 0);
+  const auto y = context.var(0, 1024);
+  const auto z = context.var(1u << 30, 1024);
+  const auto t = context.newVar();
+
+  EXPECT_NE(x, y);
+  EXPECT_NE(x, z);
+  EXPECT_NE(y, z);
+  EXPECT_NE(t, x);
+  EXPECT_EQ(x, context.var(1u << 30, 0));
+
+  // The variables are allocated contiguously.
+  EXPECT_EQ(4, context.solver().nVars());
+}
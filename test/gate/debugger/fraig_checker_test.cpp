@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/fraig_checker.h"
+#include "gate/model/gnet_test.h"
+#include "gate/premapper/mapper/mapper_test.h"
+
+#include "gtest/gtest.h"
+
+using namespace eda::gate::debugger;
+using namespace eda::gate::model;
+
+static bool checkAdders(unsigned N, bool bug, PreBasis basis) {
+  Gate::SignalList lhsInputs, lhsOutputs;
+  auto lhs = makeAdder(N, lhsInputs, lhsOutputs);
+
+  Gate::SignalList rhsInputs, rhsOutputs;
+  auto rhs = makeAdder(N, rhsInputs, rhsOutputs, bug);
+
+  GateIdMap gmap;
+  for (std::size_t i = 0; i < lhsInputs.size(); i++) {
+    gmap[lhsInputs[i].node()] = rhsInputs[i].node();
+  }
+  for (std::size_t i = 0; i < lhsOutputs.size(); i++) {
+    gmap[lhsOutputs[i].node()] = rhsOutputs[i].node();
+  }
+
+  // Premapping the right-hand net is equivalence-preserving.
+  GateIdMap premapMap;
+  auto premapped = premap(rhs, premapMap, basis);
+
+  GateIdMap composed;
+  for (const auto &[lhsId, rhsId] : gmap) {
+    composed[lhsId] = premapMap[rhsId];
+  }
+
+  return FraigChecker::get().areEqual(*lhs, *premapped, composed);
+}
+
+TEST(FraigCheckerTest, AdderAigTest) {
+  EXPECT_TRUE(checkAdders(32, false, PreBasis::AIG));
+  EXPECT_GT(FraigChecker::get().getStats().nProved, 0);
+}
+
+TEST(FraigCheckerTest, AdderMigTest) {
+  EXPECT_TRUE(checkAdders(32, false, PreBasis::MIG));
+}
+
+TEST(FraigCheckerTest, AdderXagTest) {
+  EXPECT_TRUE(checkAdders(32, false, PreBasis::XAG));
+}
+
+TEST(FraigCheckerTest, AdderBugTest) {
+  EXPECT_FALSE(checkAdders(32, true, PreBasis::AIG));
+}
+
+TEST(FraigCheckerTest, PremappedNetsTest) {
+  for (auto func : {GateSymbol::AND, GateSymbol::OR, GateSymbol::XOR,
+                    GateSymbol::NAND, GateSymbol::NOR, GateSymbol::XNOR}) {
+    auto net = makeSingleGateNet(func, 7);
+    GateIdMap gmap;
+    auto premapped = premap(net, gmap, PreBasis::AIG);
+    EXPECT_TRUE(FraigChecker::get().areEqual(*net, *premapped, gmap));
+  }
+}
@@ -0,0 +1,118 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/miter.h"
+#include "gate/debugger/rnd_checker.h"
+#include "gate/model/gnet_test.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+using namespace eda::gate::debugger;
+using namespace eda::gate::model;
+
+static std::unique_ptr<GNet> makeMiter(GNet &lhs,
+                                       const Gate::SignalList &lhsInputs,
+                                       const Gate::SignalList &lhsOutputs,
+                                       GNet &rhs,
+                                       const Gate::SignalList &rhsInputs,
+                                       const Gate::SignalList &rhsOutputs,
+                                       MiterStats &stats) {
+  GateBinding ibind, obind, tbind;
+  for (std::size_t i = 0; i < lhsInputs.size(); i++) {
+    ibind.insert({Gate::Link(lhsInputs[i].node()),
+                  Gate::Link(rhsInputs[i].node())});
+  }
+  for (std::size_t i = 0; i < lhsOutputs.size(); i++) {
+    obind.insert({Gate::Link(lhsOutputs[i].node()),
+                  Gate::Link(rhsOutputs[i].node())});
+  }
+
+  Checker::Hints hints;
+  hints.sourceBinding  = std::make_shared<GateBinding>(std::move(ibind));
+  hints.targetBinding  = std::make_shared<GateBinding>(std::move(obind));
+  hints.triggerBinding = std::make_shared<GateBinding>(std::move(tbind));
+
+  return std::unique_ptr<GNet>(miter(lhs, rhs, hints, &stats));
+}
+
+static bool isConstZero(const GNet &net) {
+  for (const auto &link : net.targetLinks()) {
+    const auto *output = Gate::get(link.source);
+    if (Gate::get(output->input(0).node())->func() != GateSymbol::ZERO) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST(MiterTest, SharedLogicTest) {
+  const unsigned N = 16;
+
+  Gate::SignalList lhsInputs, lhsOutputs;
+  auto lhs = makeAdder(N, lhsInputs, lhsOutputs);
+
+  Gate::SignalList rhsInputs, rhsOutputs;
+  auto rhs = makeAdder(N, rhsInputs, rhsOutputs);
+
+  MiterStats stats;
+  auto net = makeMiter(*lhs, lhsInputs, lhsOutputs,
+                       *rhs, rhsInputs, rhsOutputs, stats);
+
+  EXPECT_EQ(N + 1, stats.nOutputs);
+  EXPECT_EQ(N + 1, stats.nDischarged);
+  EXPECT_EQ(net->nGates(), stats.nMiterGates);
+  EXPECT_EQ(2 * N, net->nSourceLinks());
+  EXPECT_TRUE(isConstZero(*net));
+}
+
+TEST(MiterTest, ConstantPropagationTest) {
+  const unsigned N = 8;
+
+  // ~(x1 | ... | xN) and (~x1 & ... & ~xN) are hashed into the same node.
+  Gate::SignalList norInputs;
+  Gate::Id norOutputId;
+  auto norNet = makeNor(N, norInputs, norOutputId);
+
+  Gate::SignalList andnInputs;
+  Gate::Id andnOutputId;
+  auto andnNet = makeAndn(N, andnInputs, andnOutputId);
+
+  MiterStats stats;
+  auto net = makeMiter(*norNet, norInputs,
+                       {Gate::Signal::always(norOutputId)},
+                       *andnNet, andnInputs,
+                       {Gate::Signal::always(andnOutputId)}, stats);
+
+  EXPECT_EQ(1u, stats.nDischarged);
+  EXPECT_TRUE(isConstZero(*net));
+}
+
+TEST(MiterTest, DifferentOutputsTest) {
+  const unsigned N = 8;
+
+  Gate::SignalList orInputs;
+  Gate::Id orOutputId;
+  auto orNet = makeOr(N, orInputs, orOutputId);
+
+  Gate::SignalList andInputs;
+  Gate::Id andOutputId;
+  auto andNet = makeAnd(N, andInputs, andOutputId);
+
+  MiterStats stats;
+  auto net = makeMiter(*orNet, orInputs,
+                       {Gate::Signal::always(orOutputId)},
+                       *andNet, andInputs,
+                       {Gate::Signal::always(andOutputId)}, stats);
+
+  EXPECT_EQ(1u, stats.nOutputs);
+  EXPECT_EQ(0u, stats.nDischarged);
+  EXPECT_FALSE(isConstZero(*net));
+  EXPECT_EQ(NOTEQUAL, rndChecker(*net, 0, true));
+}
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/parallel_checker.h"
+#include "gate/model/gnet_test.h"
+#include "gate/premapper/mapper/mapper_test.h"
+
+#include "gtest/gtest.h"
+
+using namespace eda::gate::debugger;
+using namespace eda::gate::model;
+
+static bool checkAdders(unsigned N,
+                        bool faulty,
+                        unsigned nThreads,
+                        std::size_t groupSize) {
+  Gate::SignalList lhsInputs, lhsOutputs;
+  auto lhs = makeAdder(N, lhsInputs, lhsOutputs);
+
+  Gate::SignalList rhsInputs, rhsOutputs;
+  auto rhs = makeAdder(N, rhsInputs, rhsOutputs, faulty);
+
+  GateIdMap premapMap;
+  auto premapped = premap(rhs, premapMap, PreBasis::AIG);
+
+  GateIdMap gmap;
+  for (std::size_t i = 0; i < lhsInputs.size(); i++) {
+    gmap[lhsInputs[i].node()] = premapMap[rhsInputs[i].node()];
+  }
+  for (std::size_t i = 0; i < lhsOutputs.size(); i++) {
+    gmap[lhsOutputs[i].node()] = premapMap[rhsOutputs[i].node()];
+  }
+
+  auto &checker = ParallelChecker::get();
+  checker.setThreads(nThreads);
+  checker.setGroupSize(groupSize);
+
+  return checker.areEqual(*lhs, *premapped, gmap);
+}
+
+TEST(ParallelCheckerTest, AdderTest) {
+  EXPECT_TRUE(checkAdders(64, false, 4, 1));
+  EXPECT_TRUE(checkAdders(64, false, 4, 8));
+}
+
+TEST(ParallelCheckerTest, AdderSingleThreadTest) {
+  EXPECT_TRUE(checkAdders(64, false, 1, 4));
+}
+
+TEST(ParallelCheckerTest, FaultyAdderTest) {
+  EXPECT_FALSE(checkAdders(64, true, 4, 1));
+  EXPECT_FALSE(checkAdders(64, true, 1, 8));
+}
+
+TEST(ParallelCheckerTest, PremappedNetsTest) {
+  for (auto func : {GateSymbol::AND, GateSymbol::OR, GateSymbol::XOR,
+                    GateSymbol::NAND, GateSymbol::NOR, GateSymbol::XNOR}) {
+    auto net = makeSingleGateNet(func, 7);
+    GateIdMap gmap;
+    auto premapped = premap(net, gmap, PreBasis::AIG);
+    EXPECT_TRUE(ParallelChecker::get().areEqual(*net, *premapped, gmap));
+  }
+}
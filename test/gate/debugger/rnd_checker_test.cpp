@@ -6,7 +6,9 @@
 //
 //===----------------------------------------------------------------------===//
 #include <iostream>
+#include <memory>
 
+#include "gate/debugger/miter.h"
 #include "gate/debugger/rnd_checker.h"
 #include "gate/model/gnet_test.h"
 #include "gtest/gtest.h"
@@ -14,15 +16,99 @@
 using namespace eda::gate::debugger;
 using namespace eda::gate::model;
 
+// func(x1, ..., xN) or the constant 0 if func is ZERO.
+static std::shared_ptr<GNet> makeNet(GateSymbol func,
+                                     unsigned N,
+                                     Gate::SignalList &inputs,
+                                     Gate::Id &outputId) {
+  auto net = std::make_shared<GNet>();
+  for (unsigned i = 0; i < N; i++) {
+    inputs.push_back(Gate::Signal::always(net->addIn()));
+  }
+
+  const auto gateId = (func == GateSymbol::ZERO) ? net->addZero()
+                                                 : net->addGate(func, inputs);
+  outputId = net->addOut(gateId);
+
+  net->sortTopologically();
+  return net;
+}
+
+// Builds the miter of two single-output nets w/ the same number of inputs.
+static std::unique_ptr<GNet> makeMiter(GNet &lhs,
+                                       const Gate::SignalList &lhsInputs,
+                                       Gate::Id lhsOutputId,
+                                       GNet &rhs,
+                                       const Gate::SignalList &rhsInputs,
+                                       Gate::Id rhsOutputId) {
+  GateBinding ibind, obind, tbind;
+  for (std::size_t i = 0; i < lhsInputs.size(); i++) {
+    ibind.insert({Gate::Link(lhsInputs[i].node()),
+                  Gate::Link(rhsInputs[i].node())});
+  }
+  obind.insert({Gate::Link(lhsOutputId), Gate::Link(rhsOutputId)});
+
+  Checker::Hints hints;
+  hints.sourceBinding  = std::make_shared<GateBinding>(std::move(ibind));
+  hints.targetBinding  = std::make_shared<GateBinding>(std::move(obind));
+  hints.triggerBinding = std::make_shared<GateBinding>(std::move(tbind));
+
+  return std::unique_ptr<GNet>(miter(lhs, rhs, hints));
+}
+
+static std::unique_ptr<GNet> makeMiter(GateSymbol lhsFunc,
+                                       GateSymbol rhsFunc,
+                                       unsigned N) {
+  Gate::SignalList lhsInputs, rhsInputs;
+  Gate::Id lhsOutputId, rhsOutputId;
+
+  auto lhs = makeNet(lhsFunc, N, lhsInputs, lhsOutputId);
+  auto rhs = makeNet(rhsFunc, N, rhsInputs, rhsOutputId);
+
+  return makeMiter(*lhs, lhsInputs, lhsOutputId,
+                   *rhs, rhsInputs, rhsOutputId);
+}
+
 TEST(rnd_checkerTest, SimpleTest) {
 
-  Gate::SignalList inputs;
-  Gate::Id output;
+  Gate::SignalList lhsInputs, rhsInputs;
+  Gate::Id lhsOutputId, rhsOutputId;
 
-  auto net = makeNor(8, inputs, output);
+  // ~(x1 | ... | xN) == (~x1 & ... & ~xN).
+  auto lhs = makeNor(8, lhsInputs, lhsOutputId);
+  auto rhs = makeAndn(8, rhsInputs, rhsOutputId);
+  auto net = makeMiter(*lhs, lhsInputs, lhsOutputId,
+                       *rhs, rhsInputs, rhsOutputId);
 
   std::cout << "STARTING RND_CHECKER TEST\n";
   int a = rndChecker(*net, 0, true);
   std::cout << "CHECKER RESULT IS: \t" << a << std::endl;
   EXPECT_TRUE(a == 0);
 }
+
+TEST(rnd_checkerTest, ExhaustiveMismatchTest) {
+  // The nets differ on the only pattern: all the inputs are ones.
+  auto net = makeMiter(GateSymbol::AND, GateSymbol::ZERO, 10);
+
+  RndStats stats;
+  EXPECT_EQ(Result::NOTEQUAL, rndChecker(*net, 0, true, &stats));
+  EXPECT_EQ(10, stats.counterexample.size());
+  for (const auto &[inputId, value] : stats.counterexample) {
+    EXPECT_TRUE(value);
+  }
+}
+
+TEST(rnd_checkerTest, WideRandomTest) {
+  const unsigned N = 1000;
+
+  RndStats stats;
+  auto equal = makeMiter(GateSymbol::OR, GateSymbol::OR, N);
+  EXPECT_EQ(Result::UNKNOWN, rndChecker(*equal, 1000, false, &stats, 1));
+  EXPECT_EQ(1000, stats.nPatterns);
+  EXPECT_TRUE(stats.counterexample.empty());
+
+  auto differ = makeMiter(GateSymbol::XOR, GateSymbol::XNOR, N);
+  EXPECT_EQ(Result::NOTEQUAL, rndChecker(*differ, 1000, false, &stats, 1));
+  EXPECT_EQ(N, stats.counterexample.size());
+  EXPECT_GT(stats.patternsPerSecond(), 0);
+}
@@ -6,6 +6,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "gate/model/garray.h"
 #include "gate/model/gnet_test.h"
 
 #include "gtest/gtest.h"
@@ -13,6 +14,7 @@
 #include <algorithm>
 #include <cassert>
 #include <random>
+#include <thread>
 
 namespace eda::gate::model {
 
@@ -117,6 +119,41 @@ std::shared_ptr<GNet> makeUdp(unsigned N,
   return makeNet(UDP, N, inputs, outputId);
 }
 
+// N-bit ripple-carry adder: (x1, ..., xN) + (y1, ..., yN).
+std::shared_ptr<GNet> makeAdder(unsigned N,
+                                Gate::SignalList &inputs,
+                                Gate::SignalList &outputs,
+                                bool faulty) {
+  auto net = std::make_shared<GNet>();
+
+  Gate::SignalList xs, ys;
+  for (unsigned i = 0; i < N; i++) {
+    xs.push_back(Gate::Signal::always(net->addIn()));
+    ys.push_back(Gate::Signal::always(net->addIn()));
+  }
+  inputs.insert(inputs.end(), xs.begin(), xs.end());
+  inputs.insert(inputs.end(), ys.begin(), ys.end());
+
+  auto carry = Gate::Signal::always(net->addZero());
+  for (unsigned i = 0; i < N; i++) {
+    const auto sumFunc = (faulty && i == 0) ? GateSymbol::OR : GateSymbol::XOR;
+    const auto sum = net->addGate(sumFunc, {xs[i], ys[i], carry});
+    const auto xy = net->addAnd(xs[i], ys[i]);
+    const auto xc = net->addAnd(xs[i], carry);
+    const auto yc = net->addAnd(ys[i], carry);
+    const auto maj = net->addGate(GateSymbol::OR, {Gate::Signal::always(xy),
+                                                   Gate::Signal::always(xc),
+                                                   Gate::Signal::always(yc)});
+
+    outputs.push_back(Gate::Signal::always(net->addOut(sum)));
+    carry = Gate::Signal::always(maj);
+  }
+  outputs.push_back(Gate::Signal::always(net->addOut(carry)));
+
+  net->sortTopologically();
+  return net;
+}
+
 // Random hierarchical network.
 std::shared_ptr<GNet> makeRand(size_t nGates, size_t nSubnets) {
   assert((nGates >= 2) && "Small number of gates");
@@ -326,4 +363,248 @@ TEST(GNetTest, GNetAddressTest) {
   EXPECT_TRUE(net.get()->clone() != net.get());
 }
 
+TEST(GNetTest, GArrayTest) {
+  auto net = makeRand(1024, 256);
+  net->flatten();
+  net->sortTopologically();
+
+  GArray array(*net);
+  EXPECT_EQ(array.nGates(), net->nGates());
+
+  std::size_t nFanins = 0;
+  std::size_t nFanouts = 0;
+  for (GArray::Index i = 0; i < array.nGates(); i++) {
+    const auto *gate = net->gate(i);
+    EXPECT_EQ(array.id(i), gate->id());
+    EXPECT_EQ(array.index(gate->id()), i);
+    EXPECT_EQ(array.func(i), gate->func());
+    EXPECT_EQ(array.isSource(i), gate->isSource());
+    EXPECT_EQ(array.arity(i), gate->arity());
+
+    for (std::size_t j = 0; j < array.arity(i); j++) {
+      EXPECT_EQ(array.faninId(i, j), gate->input(j).node());
+      EXPECT_EQ(array.fanin(i, j), array.index(gate->input(j).node()));
+      nFanins += (array.fanin(i, j) != GArray::EXTERNAL);
+    }
+
+    nFanouts += array.fanout(i);
+  }
+
+  EXPECT_EQ(nFanouts, nFanins);
+}
+
+TEST(GNetTest, GateStoreTest) {
+  const auto nextId = Gate::nextId();
+
+  auto designTest = [](bool &result) {
+    GateStore store;
+    GateStore::Scope scope(store);
+
+    Gate::SignalList inputs;
+    Gate::Id outputId;
+    auto net = makeOr(16, inputs, outputId);
+
+    eda::gate::debugger::Checker checker;
+    std::unordered_map<Gate::Id, Gate::Id> gmap;
+    auto *clone = net->clone(gmap);
+
+    // Gate identifiers are local to the store.
+    result = inputs.front().node() == 0
+          && store.size() == Gate::nextId()
+          && checker.areEqual(*net, *clone, gmap);
+
+    delete clone;
+  };
+
+  bool result1 = false, result2 = false;
+  std::thread thread1(designTest, std::ref(result1));
+  std::thread thread2(designTest, std::ref(result2));
+  thread1.join();
+  thread2.join();
+
+  EXPECT_TRUE(result1);
+  EXPECT_TRUE(result2);
+  EXPECT_EQ(Gate::nextId(), nextId);
+}
+
+TEST(GNetTest, GateStoreDestroyTest) {
+  // Node w/ a non-trivial member (as VNode).
+  struct Node final : public GateBase {
+    explicit Node(std::shared_ptr<int> counter):
+        GateBase(GateSymbol::IN, {}), counter(counter) {}
+    std::shared_ptr<int> counter;
+  };
+
+  auto counter = std::make_shared<int>(0);
+  {
+    GateStore store;
+    GateStore::Scope scope(store);
+    for (size_t i = 0; i < 16; i++) {
+      new Node(counter);
+    }
+    EXPECT_EQ(counter.use_count(), 17);
+  }
+
+  // The store destroys the nodes via the virtual destructor.
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(GNetTest, StructHashTest) {
+  GateStore store;
+  GateStore::Scope scope(store);
+
+  GNet net;
+  const auto x = net.addIn();
+  const auto y = net.addIn();
+  const auto z = net.addIn();
+
+  const auto and1 = net.addAnd(x, y);
+  const auto and2 = net.addAnd(y, x);
+  const auto and3 = net.addAnd(x, z);
+  const auto dff1 = net.addDff(x, y);
+  const auto dff2 = net.addDff(y, x);
+
+  // Commutative gates are equal up to the order of the inputs.
+  EXPECT_EQ(and1, and2);
+  EXPECT_NE(and1, and3);
+  // Non-commutative gates are compared exactly.
+  EXPECT_NE(dff1, dff2);
+
+  const auto &stats = store.hashStats();
+  EXPECT_GT(stats.lookups, 0u);
+  EXPECT_GT(stats.hits, 0u);
+  EXPECT_GE(stats.probes, stats.lookups);
+  EXPECT_GT(stats.hitRate(), 0.0);
+}
+
+TEST(GNetTest, StructHashEraseTest) {
+  GateStore store;
+  GateStore::Scope scope(store);
+
+  GNet net;
+  const auto x = net.addIn();
+  const auto y = net.addIn();
+  const auto z = net.addIn();
+
+  const auto and1 = net.addAnd(x, y);
+  const auto or1 = net.addOr(x, z);
+  net.addOut(or1);
+  const auto nEntries = store.hashSize();
+
+  // The entry is rekeyed by the new function/inputs.
+  net.setOr(and1, y, z);
+  EXPECT_EQ(store.hashSize(), nEntries);
+  EXPECT_EQ(net.addOr(z, y), and1);
+  EXPECT_NE(net.addAnd(x, y), and1);
+
+  // The removed gates leave no entries.
+  const auto nAdded = store.hashSize();
+  net.removeGate(and1);
+  EXPECT_EQ(store.hashSize(), nAdded - 1);
+
+  // Backward-shift deletion keeps the colliding entries reachable.
+  std::vector<Gate::Id> gates{x};
+  for (size_t i = 1; i <= 3000; i++) {
+    gates.push_back(net.addAnd(gates[i - 1], i % 2 ? y : z));
+  }
+  for (size_t i = 1; i <= 3000; i += 3) {
+    net.removeGate(gates[i]);
+  }
+  for (size_t i = 1; i <= 3000; i++) {
+    if (i % 3 != 1) {
+      EXPECT_EQ(net.addAnd(gates[i - 1], i % 2 ? y : z), gates[i]);
+    }
+  }
+}
+
+/// Checks that the inputs of each gate precede the gate itself.
+static bool isTopologicalOrder(const GNet &net) {
+  const auto order = net.topologicalOrder();
+  if (order.size() != net.nGates()) {
+    return false;
+  }
+
+  std::unordered_set<Gate::Id> visited;
+  for (auto gid : order) {
+    const auto *gate = Gate::get(gid);
+    if (!gate->isTrigger()) {
+      for (const auto input : gate->inputs()) {
+        if (net.contains(input.node()) && !visited.count(input.node())) {
+          return false;
+        }
+      }
+    }
+    visited.insert(gid);
+  }
+
+  return true;
+}
+
+TEST(GNetTest, LogicLevelsTest) {
+  GNet net;
+  const auto x = net.addIn();
+  const auto y = net.addIn();
+  const auto z = net.addIn();
+
+  const auto and1 = net.addAnd(x, y);
+  const auto and2 = net.addAnd(and1, z);
+  const auto or1 = net.addOr(and2, x);
+  net.addOut(or1);
+
+  EXPECT_EQ(0u, net.getLogicLevel(x));
+  EXPECT_EQ(1u, net.getLogicLevel(and1));
+  EXPECT_EQ(2u, net.getLogicLevel(and2));
+  EXPECT_EQ(3u, net.getLogicLevel(or1));
+  EXPECT_EQ(5u, net.nLogicLevels());
+  EXPECT_TRUE(isTopologicalOrder(net));
+
+  // Bypassing the critical input decreases the fanout levels.
+  net.setAnd(and2, x, z);
+  EXPECT_EQ(1u, net.getLogicLevel(and2));
+  EXPECT_EQ(2u, net.getLogicLevel(or1));
+  EXPECT_EQ(4u, net.nLogicLevels());
+  EXPECT_TRUE(isTopologicalOrder(net));
+
+  // Deepening the input increases the fanout levels.
+  net.setAnd(and1, or1, y);
+  net.setOr(or1, and2, y);
+  EXPECT_EQ(3u, net.getLogicLevel(and1));
+  EXPECT_TRUE(isTopologicalOrder(net));
+
+  // Removing the critical input decreases the fanout levels.
+  net.removeGate(and2);
+  EXPECT_EQ(1u, net.getLogicLevel(or1));
+  EXPECT_EQ(2u, net.getLogicLevel(and1));
+  EXPECT_TRUE(isTopologicalOrder(net));
+
+  net.sortTopologically();
+  EXPECT_TRUE(isTopologicalOrder(net));
+}
+
+TEST(GNetTest, LogicLevelsRandTest) {
+  auto net = makeRand(1024, 256);
+  EXPECT_TRUE(isTopologicalOrder(*net));
+
+  auto flat = std::make_shared<GNet>();
+  flat->addNet(*net);
+  EXPECT_TRUE(isTopologicalOrder(*flat));
+
+  auto clone = flat->clone();
+  EXPECT_TRUE(isTopologicalOrder(*clone));
+  EXPECT_EQ(flat->nLogicLevels(), clone->nLogicLevels());
+}
+
+TEST(GNetTest, LogicLevelsCycleTest) {
+  GNet net;
+  const auto x = net.addIn();
+  const auto and1 = net.newGate();
+  const auto and2 = net.addAnd(and1, x);
+  net.addOut(and2);
+
+  // Closing the combinational cycle terminates w/ the bounded levels.
+  net.setAnd(and1, and2, x);
+  EXPECT_LE(net.getLogicLevel(and1), net.nGates());
+  EXPECT_LE(net.getLogicLevel(and2), net.nGates());
+}
+
 } // namespace eda::gate::model
@@ -49,6 +49,13 @@ std::shared_ptr<GNet> makeUdp(unsigned N,
                               Gate::SignalList &inputs,
                               Gate::Id &outputId);
 
+// N-bit ripple-carry adder: (x1, ..., xN) + (y1, ..., yN).
+// If faulty, the first sum bit is computed w/ OR instead of XOR.
+std::shared_ptr<GNet> makeAdder(unsigned N,
+                                Gate::SignalList &inputs,
+                                Gate::SignalList &outputs,
+                                bool faulty = false);
+
 // Random hierarchical network.
 std::shared_ptr<GNet> makeRand(size_t nGates, size_t nSubnets);
 
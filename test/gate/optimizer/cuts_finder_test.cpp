@@ -0,0 +1,182 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/optimizer/check_cut.h"
+#include "gate/optimizer/cuts_finder.h"
+#include "gate/optimizer/ttbuilder.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <unordered_map>
+
+namespace eda::gate::optimizer {
+
+using Gate = model::Gate;
+using GateSymbol = model::GateSymbol;
+using GNet = model::GNet;
+using Cut = CutStorage::Cut;
+
+// Random DAG w/ the given numbers of inputs and gates.
+static std::shared_ptr<GNet> makeDag(unsigned nIn, unsigned nGates) {
+  auto net = std::make_shared<GNet>();
+
+  std::vector<Gate::Id> nodes;
+  for (unsigned i = 0; i < nIn; i++) {
+    nodes.push_back(net->addIn());
+  }
+
+  const GateSymbol funcs[] = {GateSymbol::AND, GateSymbol::OR,
+                              GateSymbol::XOR, GateSymbol::NAND};
+
+  std::mt19937 gen(0);
+  for (unsigned i = 0; i < nGates; i++) {
+    std::uniform_int_distribution<size_t> nodeDist(0, nodes.size() - 1);
+    std::uniform_int_distribution<size_t> arityDist(1, 3);
+
+    Gate::SignalList inputs;
+    for (size_t j = arityDist(gen); j > 0; j--) {
+      inputs.push_back(Gate::Signal::always(nodes[nodeDist(gen)]));
+    }
+
+    const auto func =
+        inputs.size() == 1 ? GateSymbol(GateSymbol::NOT) : funcs[i % 4];
+    nodes.push_back(net->addGate(func, inputs));
+  }
+
+  net->addOut(nodes.back());
+  net->sortTopologically();
+
+  return net;
+}
+
+// Computes the truth table of the node w.r.t. the cut leaves.
+static uint64_t evaluate(Gate::Id node, const Cut &cut,
+                         std::unordered_map<Gate::Id, uint64_t> &tables) {
+  const auto i = tables.find(node);
+  if (i != tables.end()) {
+    return i->second;
+  }
+
+  const auto leaf = cut.find(node);
+  if (leaf != cut.end()) {
+    const auto k = leaf - cut.begin();
+    uint64_t table = 0;
+    for (size_t x = 0; x < 64; x++) {
+      table |= static_cast<uint64_t>((x >> k) & 1) << x;
+    }
+    return tables[node] = table;
+  }
+
+  const auto *gate = Gate::get(node);
+  TTBuilder::TruthTableList inputs;
+  for (const auto &input : gate->inputs()) {
+    inputs.push_back(evaluate(input.node(), cut, tables));
+  }
+
+  return tables[node] = TTBuilder::applyGateFunc(gate->func(), inputs);
+}
+
+static void checkCuts(const GNet &net, const CutStorage &storage,
+                      size_t cutSize, size_t maxCuts) {
+  for (const auto *gate : net.gates()) {
+    const auto &cuts = storage.cuts.at(gate->id());
+
+    ASSERT_FALSE(cuts.empty());
+    EXPECT_EQ(cuts.front(), Cut(gate->id()));
+    EXPECT_LE(cuts.size(), maxCuts + 1);
+
+    for (size_t i = 1; i < cuts.size(); i++) {
+      const auto &cut = cuts[i];
+
+      EXPECT_LE(cut.size(), cutSize);
+      EXPECT_TRUE(std::is_sorted(cut.begin(), cut.end()));
+
+      GateID failed;
+      EXPECT_TRUE(isCut(gate->id(), cut, failed));
+
+      for (size_t j = 1; j < cuts.size(); j++) {
+        EXPECT_TRUE(i == j || !cuts[j].dominates(cut));
+      }
+
+      if (cut.size() <= Cut::MAX_TABLE_SIZE) {
+        std::unordered_map<Gate::Id, uint64_t> tables;
+        EXPECT_EQ(cut.table, evaluate(gate->id(), cut, tables));
+      }
+    }
+  }
+}
+
+TEST(CutsFinderTest, CutMergeTest) {
+  Cut lhs, rhs, out;
+  EXPECT_TRUE(Cut::merge(Cut(1), Cut(3), 4, lhs));
+  EXPECT_TRUE(Cut::merge(Cut(2), Cut(3), 4, rhs));
+
+  EXPECT_TRUE(Cut::merge(lhs, rhs, 4, out));
+  EXPECT_EQ(out.size(), 3);
+  EXPECT_EQ(out.leaves[0], 1);
+  EXPECT_EQ(out.leaves[1], 2);
+  EXPECT_EQ(out.leaves[2], 3);
+
+  EXPECT_FALSE(Cut::merge(lhs, rhs, 2, out));
+  EXPECT_TRUE(lhs.dominates(out));
+  EXPECT_FALSE(out.dominates(lhs));
+  EXPECT_NE(out.find(2), out.end());
+  EXPECT_EQ(out.find(4), out.end());
+}
+
+TEST(CutsFinderTest, SequentialTest) {
+  auto net = makeDag(16, 1024);
+
+  CutStorage storage;
+  CutsFinder(4, 8, CutsFinder::leafCost, 1).find(*net, storage);
+  checkCuts(*net, storage, 4, 8);
+}
+
+TEST(CutsFinderTest, ParallelTest) {
+  auto net = makeDag(256, 8192);
+
+  CutStorage sequential;
+  CutsFinder(6, 16, CutsFinder::leafCost, 1).find(*net, sequential);
+
+  CutStorage parallel;
+  CutsFinder(6, 16, CutsFinder::leafCost, 4).find(*net, parallel);
+
+  checkCuts(*net, parallel, 6, 16);
+  EXPECT_EQ(sequential.cuts, parallel.cuts);
+}
+
+TEST(CutsFinderTest, CyclicTest) {
+  auto net = makeDag(256, 8192);
+  const auto dag = net->gates();
+
+  // Large combinational cycle hanging on the DAG.
+  std::vector<Gate::Id> cycle(1024);
+  for (auto &gid : cycle) {
+    gid = net->newGate();
+  }
+  for (size_t i = 0; i < cycle.size(); i++) {
+    const auto prev = cycle[(i + cycle.size() - 1) % cycle.size()];
+    net->setGate(cycle[i], GateSymbol::AND,
+                 {Gate::Signal::always(prev),
+                  Gate::Signal::always(dag[i]->id())});
+  }
+  net->addOut(cycle.back());
+
+  CutStorage sequential;
+  CutsFinder(6, 16, CutsFinder::leafCost, 1).find(*net, sequential);
+
+  CutStorage parallel;
+  CutsFinder(6, 16, CutsFinder::leafCost, 4).find(*net, parallel);
+
+  EXPECT_EQ(sequential.cuts, parallel.cuts);
+}
+
+} // namespace eda::gate::optimizer
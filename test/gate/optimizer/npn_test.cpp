@@ -0,0 +1,171 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/checker.h"
+#include "gate/optimizer/npn.h"
+#include "gate/optimizer/optimizer.h"
+#include "gate/optimizer/rwmanager.h"
+#include "gate/optimizer/strategy/apply_search_optimizer.h"
+#include "gate/optimizer/ttbuilder.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+namespace eda::gate::optimizer {
+
+using Gate = model::Gate;
+using GNet = model::GNet;
+using TruthTable = NpnCanonizer::TruthTable;
+
+// Random k-variable function (replicated as in TTBuilder).
+static TruthTable makeFunc(std::mt19937_64 &gen, size_t k) {
+  TruthTable func = gen();
+  for (size_t n = 1u << k; n < 64; n <<= 1) {
+    func = (func & ((1ull << n) - 1)) | (func << n);
+  }
+  return func;
+}
+
+// Random NPN transform of k variables.
+static NpnTransform makeTransform(std::mt19937_64 &gen, size_t k) {
+  NpnTransform transform;
+  transform.arity = k;
+  std::shuffle(transform.perm, transform.perm + k, gen);
+  transform.negInputs = gen() & ((1u << k) - 1);
+  transform.negOutput = gen() & 1;
+  return transform;
+}
+
+static void checkCanonize(size_t k, size_t n) {
+  std::mt19937_64 gen(k);
+
+  for (size_t i = 0; i < n; i++) {
+    const auto func = makeFunc(gen, k);
+    const auto [canon, transform] = NpnCanonizer::canonize(func, k);
+
+    EXPECT_EQ(NpnCanonizer::apply(func, k, transform), canon);
+    EXPECT_LE(transform.arity, k);
+
+    const auto other = NpnCanonizer::apply(func, k, makeTransform(gen, k));
+    EXPECT_EQ(NpnCanonizer::canonize(other, k).first, canon);
+  }
+}
+
+TEST(NpnTest, Canonize4Test) {
+  checkCanonize(4, 1000);
+}
+
+TEST(NpnTest, Canonize6Test) {
+  checkCanonize(6, 10);
+}
+
+TEST(NpnTest, SupportTest) {
+  // f(x0, x1, x2, x3) = x1 & ~x3.
+  const TruthTable func = 0x00cc00cc00cc00ccull;
+  const auto [canon, transform] = NpnCanonizer::canonize(func, 4);
+
+  EXPECT_EQ(transform.arity, 2);
+  EXPECT_EQ(std::min(transform.perm[0], transform.perm[1]), 1);
+  EXPECT_EQ(std::max(transform.perm[0], transform.perm[1]), 3);
+  EXPECT_EQ(NpnCanonizer::apply(func, 4, transform), canon);
+}
+
+TEST(NpnTest, DatabaseTest) {
+  RewriteManager::get().initialize();
+  auto database = RewriteManager::get().getDatabase();
+
+  std::mt19937_64 gen(0);
+  size_t nFound = 0;
+
+  for (size_t i = 0; i < 1000; i++) {
+    const auto func = makeFunc(gen, 4);
+    const auto [canon, transform] = NpnCanonizer::canonize(func, 4);
+
+    for (const auto &option : database->get(canon)) {
+      EXPECT_EQ(TTBuilder::build(option), canon);
+
+      const auto instance = NpnCanonizer::instantiate(option, transform);
+      EXPECT_EQ(TTBuilder::build(instance), func);
+      nFound++;
+    }
+  }
+
+  EXPECT_GT(nFound, 0);
+}
+
+TEST(NpnTest, InstanceTest) {
+  RewriteManager::get().initialize();
+  auto database = RewriteManager::get().getDatabase();
+
+  std::mt19937_64 gen(1);
+  size_t nFound = 0;
+
+  for (size_t i = 0; i < 100; i++) {
+    const auto func = makeFunc(gen, 4);
+    const auto [canon, transform] = NpnCanonizer::canonize(func, 4);
+
+    // The memoized canonization gives the same transform.
+    const auto again = NpnCanonizer::canonize(func, 4);
+    EXPECT_EQ(again.first, canon);
+    EXPECT_EQ(NpnCanonizer::apply(func, 4, again.second), canon);
+
+    for (const auto &option : database->get(canon)) {
+      const auto &instance = NpnCanonizer::getInstance(option, transform);
+      EXPECT_EQ(TTBuilder::build(instance), func);
+
+      // The repeated match does not create gates.
+      const auto nNodes = Gate::store().size();
+      const auto &cached = NpnCanonizer::getInstance(option, transform);
+      EXPECT_EQ(cached.net, instance.net);
+      EXPECT_EQ(Gate::store().size(), nNodes);
+      nFound++;
+    }
+  }
+
+  EXPECT_GT(nFound, 0);
+}
+
+TEST(NpnTest, OptimizeTest) {
+  auto net = std::make_shared<GNet>();
+
+  std::vector<Gate::Id> nodes;
+  for (size_t i = 0; i < 8; i++) {
+    nodes.push_back(net->addIn());
+  }
+
+  std::mt19937_64 gen(0);
+  for (size_t i = 0; i < 64; i++) {
+    const auto x = nodes[gen() % nodes.size()];
+    const auto y = nodes[gen() % nodes.size()];
+
+    if (x == y) {
+      nodes.push_back(net->addNot(x));
+    } else {
+      nodes.push_back(i % 3 ? net->addAnd(x, y) : net->addOr(x, y));
+    }
+  }
+
+  for (size_t i = nodes.size() - 4; i < nodes.size(); i++) {
+    net->addOut(nodes[i]);
+  }
+  net->sortTopologically();
+
+  GNet::GateIdMap gmap;
+  std::shared_ptr<GNet> optimized(net->clone(gmap));
+
+  optimize(optimized.get(), 4, ApplySearchOptimizer());
+  optimized->sortTopologically();
+
+  debugger::Checker checker;
+  EXPECT_TRUE(checker.areEqual(*net, *optimized, gmap));
+}
+
+} // namespace eda::gate::optimizer
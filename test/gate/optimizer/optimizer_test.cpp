@@ -0,0 +1,184 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/checker.h"
+#include "gate/optimizer/optimizer.h"
+#include "gate/optimizer/strategy/apply_search_optimizer.h"
+#include "gate/optimizer/strategy/delay_aware_optimizer.h"
+#include "gate/optimizer/strategy/exhaustive_search_optimizer.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <random>
+
+namespace eda::gate::optimizer {
+
+static std::shared_ptr<GNet> makeRandomAig(size_t nIn,
+                                           size_t nGates,
+                                           size_t nOut,
+                                           unsigned seed) {
+  auto net = std::make_shared<GNet>();
+
+  std::vector<Gate::Id> nodes;
+  for (size_t i = 0; i < nIn; i++) {
+    nodes.push_back(net->addIn());
+  }
+
+  std::mt19937_64 gen(seed);
+  for (size_t i = 0; i < nGates; i++) {
+    const auto x = nodes[gen() % nodes.size()];
+    const auto y = nodes[gen() % nodes.size()];
+
+    if (x == y) {
+      nodes.push_back(net->addNot(x));
+    } else {
+      nodes.push_back(i % 3 ? net->addAnd(x, y) : net->addOr(x, y));
+    }
+  }
+
+  for (size_t i = nodes.size() - nOut; i < nodes.size(); i++) {
+    net->addOut(nodes[i]);
+  }
+  net->sortTopologically();
+
+  return net;
+}
+
+// Deep unbalanced AIG: each gate extends the chain w/ a random node.
+static std::shared_ptr<GNet> makeChainAig(size_t nIn,
+                                          size_t nGates,
+                                          unsigned seed) {
+  auto net = std::make_shared<GNet>();
+
+  std::vector<Gate::Id> nodes;
+  for (size_t i = 0; i < nIn; i++) {
+    nodes.push_back(net->addIn());
+  }
+
+  std::mt19937_64 gen(seed);
+  auto last = nodes.front();
+  for (size_t i = 0; i < nGates; i++) {
+    const auto x = nodes[gen() % nodes.size()];
+    if (x == last) {
+      continue;
+    }
+
+    last = gen() % 3 ? net->addAnd(last, x) : net->addOr(last, x);
+    nodes.push_back(last);
+  }
+
+  net->addOut(last);
+  net->sortTopologically();
+
+  return net;
+}
+
+TEST(OptimizerTest, MultiPassTest) {
+  auto net = makeRandomAig(8, 128, 8, 1);
+
+  GNet::GateIdMap gmap;
+  std::shared_ptr<GNet> optimized(net->clone(gmap));
+
+  RewriteParams params;
+  params.maxPasses = 4;
+  params.minGain = 0;
+
+  const auto nGates = optimized->nGates();
+  const auto stats = optimize(optimized.get(), 4, ApplySearchOptimizer(),
+                              params);
+
+  ASSERT_FALSE(stats.passes.empty());
+  EXPECT_LE(stats.passes.size(), params.maxPasses);
+  EXPECT_EQ(static_cast<long>(nGates - optimized->nGates()), stats.nSaved());
+  EXPECT_GT(stats.passes[0].nCandidates, 0u);
+  EXPECT_EQ(0u, stats.passes[0].nRecut);
+
+  for (size_t i = 1; i < stats.passes.size(); i++) {
+    EXPECT_GT(stats.passes[i - 1].nApplied, 0u);
+  }
+
+  optimized->sortTopologically();
+
+  debugger::Checker checker;
+  EXPECT_TRUE(checker.areEqual(*net, *optimized, gmap));
+}
+
+TEST(OptimizerTest, SinglePassTest) {
+  auto net = makeRandomAig(8, 64, 4, 2);
+
+  GNet::GateIdMap gmap;
+  std::shared_ptr<GNet> optimized(net->clone(gmap));
+
+  RewriteParams params;
+  params.maxPasses = 1;
+
+  const auto stats = optimize(optimized.get(), 4,
+                              ExhausitiveSearchOptimizer("abc"), params);
+  EXPECT_EQ(1u, stats.passes.size());
+  EXPECT_LE(stats.passes[0].nApplied, stats.passes[0].nCandidates);
+
+  optimized->sortTopologically();
+
+  debugger::Checker checker;
+  EXPECT_TRUE(checker.areEqual(*net, *optimized, gmap));
+}
+
+static std::shared_ptr<GNet> optimizeDelayAware(GNet &net,
+                                                float delayWeight) {
+  GNet::GateIdMap gmap;
+  std::shared_ptr<GNet> optimized(net.clone(gmap));
+
+  RewriteParams params;
+  params.maxPasses = 4;
+  params.minGain = 0;
+
+  const auto nLevels = optimized->nLogicLevels();
+  optimize(optimized.get(), 4, DelayAwareOptimizer("abc", delayWeight),
+           params);
+
+  // The replacements increasing the depth are rejected.
+  EXPECT_LE(optimized->nLogicLevels(), nLevels);
+
+  optimized->sortTopologically();
+
+  debugger::Checker checker;
+  EXPECT_TRUE(checker.areEqual(net, *optimized, gmap));
+
+  return optimized;
+}
+
+static void checkDelayAware(float delayWeight, unsigned seed) {
+  auto net = makeRandomAig(8, 128, 8, seed);
+  optimizeDelayAware(*net, delayWeight);
+}
+
+TEST(OptimizerTest, DelayAwareAreaTest) {
+  for (unsigned seed = 1; seed <= 4; seed++) {
+    checkDelayAware(0, seed);
+  }
+}
+
+TEST(OptimizerTest, DelayAwareDelayTest) {
+  for (unsigned seed = 1; seed <= 4; seed++) {
+    checkDelayAware(1, seed);
+  }
+}
+
+TEST(OptimizerTest, DelayAwareTradeoffTest) {
+  auto net = makeChainAig(6, 32, 2);
+
+  const auto area = optimizeDelayAware(*net, 0);
+  const auto delay = optimizeDelayAware(*net, 1);
+
+  // The delay-oriented rewriting trades the area for the depth.
+  EXPECT_LT(delay->nLogicLevels(), area->nLogicLevels());
+  EXPECT_LT(area->nGates(), delay->nGates());
+}
+
+} // namespace eda::gate::optimizer
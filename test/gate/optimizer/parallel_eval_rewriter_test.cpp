@@ -0,0 +1,146 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/checker.h"
+#include "gate/optimizer/database/abc.h"
+#include "gate/optimizer/rwmanager.h"
+#include "gate/optimizer/parallel_eval_rewriter.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <memory>
+#include <random>
+
+namespace eda::gate::optimizer {
+
+static std::shared_ptr<GNet> makeRandomAig(size_t nIn,
+                                           size_t nGates,
+                                           size_t nOut,
+                                           unsigned seed) {
+  auto net = std::make_shared<GNet>();
+
+  std::vector<Gate::Id> nodes;
+  for (size_t i = 0; i < nIn; i++) {
+    nodes.push_back(net->addIn());
+  }
+
+  std::mt19937_64 gen(seed);
+  for (size_t i = 0; i < nGates; i++) {
+    const auto x = nodes[gen() % nodes.size()];
+    const auto y = nodes[gen() % nodes.size()];
+
+    if (x == y) {
+      nodes.push_back(net->addNot(x));
+    } else {
+      nodes.push_back(i % 3 ? net->addAnd(x, y) : net->addOr(x, y));
+    }
+  }
+
+  for (size_t i = nodes.size() - nOut; i < nodes.size(); i++) {
+    net->addOut(nodes[i]);
+  }
+  net->sortTopologically();
+
+  return net;
+}
+
+// Writes the ABC database to the binary file.
+static void writeAbc(const std::string &binPath) {
+  struct Database final : public RWDatabase {
+    std::vector<BinaryRWDatabase::Entry> entries() const {
+      return {_storage.begin(), _storage.end()};
+    }
+  } database;
+
+  initializeAbcRwDatabase(database);
+
+  const auto entries = database.entries();
+  for (const auto &[func, subnets] : entries) {
+    for (const auto &subnet : subnets) {
+      subnet.net->sortTopologically();
+    }
+  }
+
+  BinaryRWDatabase::write(binPath, entries);
+}
+
+static RewriteStats rewrite(GNet &net,
+                            unsigned nThreads,
+                            size_t windowSize,
+                            size_t &nGates,
+                            const std::string &library = "abc") {
+  GNet::GateIdMap gmap;
+  std::shared_ptr<GNet> rewritten(net.clone(gmap));
+
+  ParallelEvalRewriter rewriter(library, 4, nThreads, windowSize);
+  const auto stats = rewriter.rewrite(*rewritten);
+  nGates = rewritten->nGates();
+
+  rewritten->sortTopologically();
+
+  debugger::Checker checker;
+  EXPECT_TRUE(checker.areEqual(net, *rewritten, gmap));
+
+  return stats;
+}
+
+TEST(ParallelEvalRewriterTest, EquivalenceTest) {
+  for (unsigned seed = 1; seed <= 4; seed++) {
+    auto net = makeRandomAig(8, 256, 8, seed);
+
+    size_t nGates = 0;
+    const auto stats = rewrite(*net, 4, 16, nGates);
+
+    ASSERT_FALSE(stats.passes.empty());
+    EXPECT_LE(stats.passes[0].parallelTime, stats.passes[0].time);
+    EXPECT_EQ(static_cast<long>(net->nGates() - nGates), stats.nSaved());
+    EXPECT_GE(stats.nSaved(), 0);
+  }
+}
+
+TEST(ParallelEvalRewriterTest, ThreadsTest) {
+  auto net = makeRandomAig(16, 1024, 16, 5);
+
+  size_t nGates1 = 0;
+  const auto stats1 = rewrite(*net, 1, 64, nGates1);
+
+  size_t nGates4 = 0;
+  const auto stats4 = rewrite(*net, 4, 64, nGates4);
+
+  EXPECT_GT(stats1.nSaved(), 0);
+
+  // The result does not depend on the number of threads.
+  EXPECT_EQ(nGates1, nGates4);
+  EXPECT_EQ(stats1.passes.size(), stats4.passes.size());
+  EXPECT_EQ(stats1.passes[0].nApplied, stats4.passes[0].nApplied);
+}
+
+TEST(ParallelEvalRewriterTest, BinaryDatabaseTest) {
+  const std::string binPath = "parallel_eval_rewriter.bin";
+  writeAbc(binPath);
+
+  // The subnets are decoded lazily into the store read by the workers.
+  RewriteManager::get().setBinary(binPath, "binary");
+
+  auto net = makeRandomAig(16, 1024, 16, 6);
+
+  size_t nGates = 0;
+  const auto stats = rewrite(*net, 1, 64, nGates);
+
+  size_t nGatesBinary = 0;
+  const auto statsBinary = rewrite(*net, 4, 64, nGatesBinary, "binary");
+
+  EXPECT_GT(statsBinary.nSaved(), 0);
+  EXPECT_EQ(nGates, nGatesBinary);
+  EXPECT_EQ(stats.passes.size(), statsBinary.passes.size());
+
+  std::remove(binPath.c_str());
+}
+
+} // namespace eda::gate::optimizer
@@ -8,9 +8,13 @@
 
 #include "gate/transformer/bdd.h"
 #include "gate/optimizer/rwdatabase.h"
+#include "gate/optimizer/rwmanager.h"
 
 #include "gtest/gtest.h"
 
+#include <cstdio>
+#include <fstream>
+
 using BDDList = eda::gate::transformer::GNetBDDConverter::BDDList;
 using Gate = eda::gate::model::Gate;
 using GateBDDMap = eda::gate::transformer::GNetBDDConverter::GateBDDMap;
@@ -19,6 +23,8 @@ using GateSymbol = eda::gate::model::GateSymbol;
 using GateUintMap = eda::gate::transformer::GNetBDDConverter::GateUintMap;
 using GNet = eda::gate::model::GNet;
 using GNetBDDConverter = eda::gate::transformer::GNetBDDConverter;
+using BinaryRWDatabase = eda::gate::optimizer::BinaryRWDatabase;
+using RewriteManager = eda::gate::optimizer::RewriteManager;
 using RWDatabase = eda::gate::optimizer::RWDatabase;
 using SQLiteRWDatabase = eda::gate::optimizer::SQLiteRWDatabase;
 
@@ -247,6 +253,163 @@ bool deleteARWDBTest() {
   return result;
 }
 
+bool binaryARWDBTest() {
+  SQLiteRWDatabase arwdb;
+  BinaryRWDatabase brwdb;
+  std::string dbPath = "rwtest.db";
+  std::string binPath = "rwtest.bin";
+  bool result = false;
+
+  try {
+    arwdb.linkDB(dbPath);
+    arwdb.openDB();
+
+    Gate::SignalList inputs1;
+    Gate::Id outputId1;
+    GateList varList1;
+    std::shared_ptr<GNet> dummy1 = std::make_shared<GNet>
+                                   (*makeAnd2(inputs1, outputId1, varList1));
+    RWDatabase::GateBindings bindings1 = {{0, inputs1[0].node()},
+                                          {1, inputs1[1].node()}};
+
+    Gate::SignalList inputs2;
+    Gate::Id outputId2;
+    GateList varList2;
+    std::shared_ptr<GNet> dummy2 = std::make_shared<GNet>
+                                   (*makeOr2(inputs2, outputId2, varList2));
+    RWDatabase::GateBindings bindings2 = {{0, inputs2[0].node()},
+                                          {1, inputs2[1].node()}};
+
+    dummy1->sortTopologically();
+    dummy2->sortTopologically();
+
+    RWDatabase::BoundGNetList bgl1 = {{dummy1, bindings1, {{0, 1.5}}}};
+    RWDatabase::BoundGNetList bgl2 = {{dummy2, bindings2}, {dummy1, bindings1}};
+
+    // The keys w/ the highest bit set are stored as negative integers.
+    RWDatabase::TruthTable truthTable1 = 0x8888888888888888ull;
+    RWDatabase::TruthTable truthTable2 = 0xeeeeeeeeeeeeeeeeull;
+
+    arwdb.insertIntoDB(truthTable2, bgl2);
+    arwdb.insertIntoDB(truthTable1, bgl1);
+    arwdb.closeDB();
+
+    BinaryRWDatabase::convert(dbPath, binPath);
+    brwdb.openDB(binPath);
+
+    auto newBgl1 = brwdb.get(truthTable1);
+    auto newBgl2 = brwdb.get(truthTable2);
+
+    result = brwdb.size() == 2 &&
+             brwdb.contains(truthTable1) &&
+             !brwdb.contains(1) &&
+             brwdb.get(1).empty() &&
+             newBgl1.size() == 1 && newBgl2.size() == 2 &&
+             newBgl1[0].inputsDelay == bgl1[0].inputsDelay &&
+             areEquivalent(bgl1[0], newBgl1[0]) &&
+             areEquivalent(bgl2[0], newBgl2[0]) &&
+             areEquivalent(bgl2[1], newBgl2[1]);
+
+    brwdb.closeDB();
+  } catch (const char* msg) {
+    std::cout << msg << std::endl;
+  }
+  remove(dbPath.c_str());
+  remove(binPath.c_str());
+  return result;
+}
+
+// Writes the binary database w/ the 2-input AND.
+static void writeAnd2(const std::string &binPath,
+                      RWDatabase::TruthTable truthTable) {
+  Gate::SignalList inputs;
+  Gate::Id outputId;
+  GateList varList;
+  std::shared_ptr<GNet> net = makeAnd2(inputs, outputId, varList);
+  RWDatabase::GateBindings bindings = {{0, inputs[0].node()},
+                                       {1, inputs[1].node()}};
+
+  BinaryRWDatabase::write(binPath, {{truthTable, {{net, bindings}}}});
+}
+
+// Overwrites the 32-bit word of the file at the given offset.
+static void corrupt(const std::string &binPath, long offset, uint32_t word) {
+  std::fstream file(binPath, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekp(offset, offset < 0 ? std::ios::end : std::ios::beg);
+  file.write(reinterpret_cast<const char*>(&word), sizeof(word));
+}
+
+bool managerBinaryTest() {
+  std::string binPath = "rwmanager.bin";
+  RWDatabase::TruthTable truthTable = 0x8888888888888888ull;
+  bool result = false;
+
+  try {
+    writeAnd2(binPath, truthTable);
+
+    auto &manager = RewriteManager::get();
+    manager.setBinary(binPath, "rwmanager");
+    manager.initialize("rwmanager");
+
+    auto database = manager.getDatabase("rwmanager");
+    auto list = database->get(truthTable);
+
+    result = list.size() == 1 &&
+             list[0].bindings.size() == 2 &&
+             database->get(1).empty();
+  } catch (const char* msg) {
+    std::cout << msg << std::endl;
+  }
+  remove(binPath.c_str());
+  return result;
+}
+
+// Checks that the corrupted file is rejected on get().
+static bool isRejected(const std::string &binPath,
+                       RWDatabase::TruthTable truthTable) {
+  BinaryRWDatabase brwdb;
+  brwdb.openDB(binPath);
+  try {
+    brwdb.get(truthTable);
+  } catch (const char*) {
+    return true;
+  }
+  return false;
+}
+
+bool invalidBinaryTest() {
+  std::string binPath = "rwinvalid.bin";
+  RWDatabase::TruthTable truthTable = 0x8888888888888888ull;
+  bool result = false;
+
+  // Header: magic (8), version (4), nKeys (4), nWords (8).
+  // Index entry: key (8), offset (4), nNets (4).
+  const long offsetPos = 8 + 4 + 4 + 8 + 8;
+
+  try {
+    // The offset of the nets is out of the file.
+    writeAnd2(binPath, truthTable);
+    corrupt(binPath, offsetPos, 0xffffff);
+    result = isRejected(binPath, truthTable);
+
+    // The output's fanin refers to itself (the last word of the file).
+    writeAnd2(binPath, truthTable);
+    corrupt(binPath, -4, 3);
+    result = result && isRejected(binPath, truthTable);
+
+    // The number of gates exceeds the file.
+    writeAnd2(binPath, truthTable);
+    const long nGatesPos = offsetPos + 4 + 4;
+    corrupt(binPath, nGatesPos, 0xffffffff);
+    result = result && isRejected(binPath, truthTable);
+  } catch (const char* msg) {
+    std::cout << msg << std::endl;
+    result = false;
+  }
+  remove(binPath.c_str());
+  return result;
+}
+
 TEST(RWDatabaseTest, BasicTest) {
   EXPECT_TRUE(basicTest());
 }
@@ -262,3 +425,15 @@ TEST(RWDatabaseTest, UpdateARWDBTest) {
 TEST(RWDatabaseTest, DeleteARWDBTest) {
   EXPECT_TRUE(deleteARWDBTest());
 }
+
+TEST(RWDatabaseTest, BinaryARWDBTest) {
+  EXPECT_TRUE(binaryARWDBTest());
+}
+
+TEST(RWDatabaseTest, ManagerBinaryTest) {
+  EXPECT_TRUE(managerBinaryTest());
+}
+
+TEST(RWDatabaseTest, InvalidBinaryTest) {
+  EXPECT_TRUE(invalidBinaryTest());
+}
@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/optimizer/util.h"
+
+#include "gtest/gtest.h"
+
+using namespace eda::gate::model;
+using namespace eda::gate::optimizer;
+
+TEST(OptimizerUtilTest, MffcTest) {
+  GNet net;
+  const auto x = net.addIn();
+  const auto y = net.addIn();
+  const auto z = net.addIn();
+
+  const auto and1 = net.addAnd(x, y);
+  const auto and2 = net.addAnd(y, z);
+  const auto or1 = net.addOr(and1, and2);
+  net.addOut(or1);
+  net.addOut(and2);
+
+  EXPECT_EQ(2u, net.getRefs(y));
+  EXPECT_EQ(1u, net.getRefs(and1));
+  EXPECT_EQ(2u, net.getRefs(and2));
+
+  // The shared gate does not belong to the MFFC.
+  EXPECT_EQ(2u, derefMffc(net, or1));
+  EXPECT_EQ(0u, net.getRefs(and1));
+  EXPECT_EQ(1u, net.getRefs(and2));
+
+  EXPECT_EQ(2u, refMffc(net, or1));
+  EXPECT_EQ(1u, net.getRefs(and1));
+  EXPECT_EQ(2u, net.getRefs(and2));
+}
+
+TEST(OptimizerUtilTest, FakeSubstituteTest) {
+  GNet net;
+  const auto x = net.addIn();
+  const auto y = net.addIn();
+  const auto z = net.addIn();
+
+  const auto and1 = net.addAnd(x, y);
+  const auto and2 = net.addAnd(and1, z);
+  net.addOut(and2);
+
+  // Three-input AND.
+  GNet subnet1;
+  const auto s1 = subnet1.newGate();
+  const auto s2 = subnet1.newGate();
+  const auto s3 = subnet1.newGate();
+  subnet1.addAnd({Gate::Signal::always(s1),
+                  Gate::Signal::always(s2),
+                  Gate::Signal::always(s3)});
+  subnet1.sortTopologically();
+
+  const std::unordered_map<GateID, GateID> map1{{s1, x}, {s2, y}, {s3, z}};
+  EXPECT_EQ(-1, fakeSubstitute(and2, map1, &subnet1, &net));
+
+  // The same structure reuses the gate of the MFFC.
+  GNet subnet2;
+  const auto t1 = subnet2.newGate();
+  const auto t2 = subnet2.newGate();
+  const auto t3 = subnet2.newGate();
+  subnet2.addAnd(subnet2.addAnd(t1, t2), t3);
+  subnet2.sortTopologically();
+
+  const std::unordered_map<GateID, GateID> map2{{t1, x}, {t2, y}, {t3, z}};
+  EXPECT_EQ(0, fakeSubstitute(and2, map2, &subnet2, &net));
+
+  // The reference counters are restored.
+  EXPECT_EQ(1u, net.getRefs(x));
+  EXPECT_EQ(1u, net.getRefs(and1));
+  EXPECT_EQ(1u, net.getRefs(and2));
+}
@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the Utopia EDA Project, under the Apache License v2.0
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2026 ISP RAS (http://www.ispras.ru)
+//
+//===----------------------------------------------------------------------===//
+
+#include "gate/debugger/miter.h"
+#include "gate/model/gnet_test.h"
+#include "gate/printer/aig_export.h"
+
+#include "gtest/gtest.h"
+#include "minisat/core/Solver.h"
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+using namespace eda::gate::debugger;
+using namespace eda::gate::model;
+using namespace eda::gate::printer;
+
+// Loads the DIMACS CNF into the solver and solves it.
+static bool solveDimacs(std::istream &in) {
+  Minisat::Solver solver;
+
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == 'c' || line[0] == 'p') continue;
+
+    std::istringstream tokens(line);
+    Minisat::vec<Minisat::Lit> clause;
+    long lit;
+    while (tokens >> lit && lit != 0) {
+      const auto var = static_cast<Minisat::Var>(std::labs(lit) - 1);
+      while (var >= solver.nVars()) solver.newVar();
+      clause.push(Minisat::mkLit(var, lit < 0));
+    }
+    solver.addClause(clause);
+  }
+
+  return solver.solve();
+}
+
+static std::unique_ptr<GNet> makeAdderMiter(unsigned N, bool faulty) {
+  Gate::SignalList lhsInputs, lhsOutputs;
+  auto lhs = makeAdder(N, lhsInputs, lhsOutputs);
+
+  Gate::SignalList rhsInputs, rhsOutputs;
+  auto rhs = makeAdder(N, rhsInputs, rhsOutputs, faulty);
+
+  GateBinding ibind, obind, tbind;
+  for (std::size_t i = 0; i < lhsInputs.size(); i++) {
+    ibind.insert({Gate::Link(lhsInputs[i].node()),
+                  Gate::Link(rhsInputs[i].node())});
+  }
+  for (std::size_t i = 0; i < lhsOutputs.size(); i++) {
+    obind.insert({Gate::Link(lhsOutputs[i].node()),
+                  Gate::Link(rhsOutputs[i].node())});
+  }
+
+  Checker::Hints hints;
+  hints.sourceBinding  = std::make_shared<GateBinding>(std::move(ibind));
+  hints.targetBinding  = std::make_shared<GateBinding>(std::move(obind));
+  hints.triggerBinding = std::make_shared<GateBinding>(std::move(tbind));
+
+  return std::unique_ptr<GNet>(miter(*lhs, *rhs, hints));
+}
+
+TEST(AigExportTest, AigerAndTest) {
+  Gate::SignalList inputs;
+  Gate::Id outputId;
+  auto net = makeAnd(2, inputs, outputId);
+
+  std::stringstream out;
+  EXPECT_TRUE(writeAiger(out, *net));
+
+  // The AND: lhs = 6, rhs0 = 4, rhs1 = 2.
+  EXPECT_EQ(std::string("aig 3 2 0 1 1\n6\n\x02\x02"), out.str());
+}
+
+TEST(AigExportTest, AigerHeaderTest) {
+  Gate::SignalList inputs;
+  Gate::Id outputId;
+  auto net = makeNor(8, inputs, outputId);
+
+  std::stringstream out;
+  EXPECT_TRUE(writeAiger(out, *net));
+
+  std::string header;
+  std::getline(out, header);
+  EXPECT_EQ("aig 15 8 0 1 7", header);
+
+  std::string output;
+  std::getline(out, output);
+  EXPECT_EQ("30", output);
+}
+
+TEST(AigExportTest, DimacsMiterTest) {
+  auto equal = makeAdderMiter(8, false);
+  auto faulty = makeAdderMiter(8, true);
+
+  std::stringstream equalCnf;
+  EXPECT_TRUE(writeDimacs(equalCnf, *equal));
+  EXPECT_FALSE(solveDimacs(equalCnf));
+
+  std::stringstream faultyCnf;
+  EXPECT_TRUE(writeDimacs(faultyCnf, *faulty));
+  EXPECT_TRUE(solveDimacs(faultyCnf));
+}
+
+TEST(AigExportTest, UnsupportedTest) {
+  GNet net;
+  const auto x = net.addIn();
+  const auto clk = net.addIn();
+  net.addOut(net.addDff(x, clk));
+  net.sortTopologically();
+
+  std::stringstream out;
+  EXPECT_FALSE(writeAiger(out, net));
+  EXPECT_FALSE(writeDimacs(out, net));
+  EXPECT_TRUE(out.str().empty());
+}
@@ -67,3 +67,56 @@ TEST(SimulatorGNetTest, SimulatorNorTest) {
 TEST(SimulatorGNetTest, SimulatorAndnTest) {
   EXPECT_TRUE(simulatorAndnTest(4));
 }
+
+bool simulatorMajParallelTest(unsigned N) {
+  // maj(x1, ..., xN) computed for 64 patterns at once.
+  Gate::SignalList inputs;
+  Gate::Id output;
+
+  auto net = makeMaj(N, inputs, output);
+
+  GNet::LinkList in;
+  GNet::LinkList out{Gate::Link(output)};
+
+  for (auto input : inputs) {
+    in.push_back(Gate::Link(input.node()));
+  }
+
+  auto compiled = simulator.compile(*net, in, out);
+
+  using Compiled = Simulator::Compiled;
+  const std::uint64_t nBlocks = N > 6 ? (1ull << (N - 6)) : 1;
+
+  Compiled::WV i(N), o(1);
+  for (std::uint64_t block = 0; block < nBlocks; block++) {
+    for (unsigned k = 0; k < N; k++) {
+      i[k] = Compiled::exhaustive(k, block);
+    }
+    compiled.simulate(o, i);
+
+    for (std::uint64_t j = 0; j < Compiled::WIDTH; j++) {
+      const auto pattern = block * Compiled::WIDTH + j;
+      if (pattern >= (1ull << N)) break;
+
+      const bool expected = __builtin_popcountll(pattern) > (N >> 1);
+      const bool actual = (o[0] >> j) & 1;
+      if (expected != actual) {
+        return false;
+      }
+
+      // Check against the single-pattern mode.
+      std::uint64_t scalar;
+      compiled.simulate(scalar, pattern);
+      if (scalar != actual) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+TEST(SimulatorGNetTest, SimulatorMajParallelTest) {
+  EXPECT_TRUE(simulatorMajParallelTest(3));
+  EXPECT_TRUE(simulatorMajParallelTest(9));
+}